@@ -18,11 +18,11 @@ typedef	int	label;		/* type of a label value */
 typedef	short	opcode;		/* type of an opcode */
 
 /*	Gate-level stuff... */
-#define	MAXGATES (1024*1024)	/* Size of gate pool */
+#define	GATECHUNK (16*1024)	/* Initial size of gate pool */
 #define	MAXDIM 8		/* Maximum dimension of array */
-#define	BUSWIDTH 8		/* Bus width */
+#define	MAXWIDTH 64		/* Widest bus -w allows */
+#define	BUSWIDTH buswidth	/* Bus width, 8 unless -w */
 #define	forbus(I)	for (I=0; I<BUSWIDTH; ++I)
-#define	forbusdim(I)	for (I=0; I<(BUSWIDTH*MAXDIM); ++I)
 #define	forbusrev(I)	for (I=BUSWIDTH-1; I>=0; --I)
 #define	forgates(I)	for (I=0; I<gatesp; ++I)
 
@@ -34,10 +34,6 @@ typedef struct {
 	char	needed;		/* Is this needed? */
 } gate_t;
 
-typedef struct {
-	int	wire[BUSWIDTH*MAXDIM];
-} bus_t;
-
 /*	Symbol table (variable) struct... */
 #define	var	struct _var
 var {
@@ -46,36 +42,55 @@ var {
 	int	dim;		/* size of dimension (1 means scalar) */
 	int	deflev;		/* scope level of definition */
 	int	defblk;		/* block number of definition */
-	bus_t	bus;		/* bus value */
+	int	*bus;		/* BUSWIDTH wires per element, once gateified */
+	struct _tuple *acc;	/* last LDX/STX of this var in block accblk */
+	int	accblk;		/* code block acc belongs to */
 };
 
 #define	MAXV	1024		/* maximum number of vars */
 #define	MODV(x)	((x)&(MAXV-1))	/* x mod MAXV */
 
-#define	VARBIAS	1000000		/* magic bias to ID var bits */
-#define	VARPTR2NUM(X)	(((X)-&(symtab[0]))*VARBIAS)
-#define	NUM2VARPTR(X)	(&(symtab[(X)/VARBIAS]))
+#define	VARBIAS	(1<<30)		/* magic bias to ID var bits; gates stay below */
+#define	VARSPAN	1024		/* room for the bus wires of each var */
+#define	VARPTR2NUM(X)	(VARBIAS+(((X)-&(symtab[0]))*VARSPAN))
+#define	NUM2VARPTR(X)	(&(symtab[((X)-VARBIAS)/VARSPAN]))
+#define	NUM2VARBIT(X)	(((X)-VARBIAS)%VARSPAN)
 
 /*	Tuple struct... */
 #define	tuple	struct _tuple
 tuple {
 	tuple	*next, *prev;	/* sequential order links */
 	opcode	oarg;		/* tuple opcode */
-	tuple	*targ[2];	/* tuple arguments */
 	konst	carg;		/* constant argument */
+	tuple	*targ[2];	/* tuple arguments */
 	label	larg[2];	/* label arguments */
 	var	*varg;		/* variable name argument */
-	int	refs;		/* how many refs to this? */
+	int	refs;		/* how many live refs to this? */
 	int	slot;		/* scheduled parallel execution slot */
-	bus_t	bus;		/* bus for bit-level value */
+	int	seq;		/* position in code (kept in order, see ttoi) */
+	tuple	*hnext;		/* value numbering hash chain */
+	tuple	*vprev, *vnext;	/* LDX/STX of the same var in this block */
+	tuple	*dnext;		/* waiting for dead() to check refs */
+	int	*bus;		/* BUSWIDTH wires of bit-level value, once gateified */
 };
 
+/*	Basic block struct, for the control flow graph... */
+typedef struct {
+	tuple	*first, *last;	/* its tuples, in code order */
+	tuple	*sel;		/* SEL that ends it, or 0 if it falls through */
+	int	succ[2], nsucc;	/* blocks it can go to */
+	int	*pred, npred;	/* blocks that can come to it */
+	int	rpo;		/* reverse postorder number, -1 if not reached */
+	int	idom;		/* immediate dominator (top is its own), -1 if not reached */
+} block_t;
+
 /*	token types... */
 #define	ADD	'+'
 #define	SUB	'-'
 #define	AND	'&'
 #define	OR	'|'
 #define	XOR	'^'
+#define	MUL	'*'
 #define	GT	'>'
 #define	GE	512
 #define	EQ	513
@@ -112,10 +127,62 @@ tuple {
 #define	OUTPAR	0x04
 #define	OUTSEQ	0x08
 #define	OUTVER	0x10
+#define	OUTSIM	0x20
+#define	OUTEVAL	0x40
+#define	OUTBIN	0x80
+#define	OUTBITS	(OUTDOT | OUTGATE | OUTVER | OUTSIM | OUTEVAL | OUTBIN)	/* any gate-level output */
+
+/*	Gate-level adders (-a)... */
+#define	ADDQUIET	(-1)	/* ripple carry, no -a given */
+#define	ADDRIPPLE	0	/* ripple carry */
+#define	ADDKOGGE	1	/* Kogge-Stone prefix */
+#define	ADDBRENT	2	/* Brent-Kung prefix */
+#define	ADDHAN	3	/* Han-Carlson prefix */
 
+/*	Machine model for the VLIW scheduler... */
+#define	MAXUNITS	8	/* functional unit classes */
+#define	MAXUNITN	16	/* units in one class */
+#define	NOPCODES	(KILL + 1)
+
+typedef struct {
+	char	name[16];	/* unit class name */
+	int	count;		/* how many of them */
+	int	busy;		/* slots one stays busy per op */
+} unit_t;
+
+typedef struct {
+	int	width;		/* issue slots per cycle, 0 if not set */
+	int	nunits;		/* unit classes */
+	unit_t	unit[MAXUNITS];
+	int	lat[NOPCODES];	/* slots until the result can be used */
+	int	use[NOPCODES];	/* unit class needed, or -1 */
+} machine_t;
+
+/*	Recorded input, replayed to unroll loops... */
+typedef struct {
+	int	*c;		/* characters read */
+	int	n, max;		/* how many, and room for */
+} tape_t;
+
+
+/*	Buffered output... */
+typedef struct {
+	char	*buf;		/* text not yet written */
+	int	n, max;		/* how much, and room for */
+	FILE	*f;		/* where it goes, or 0 to keep it */
+} out_t;
+#define	outc(O, C)	do { if ((O)->n >= (O)->max) outroom((O), 1); \
+			     (O)->buf[((O)->n)++] = (C); } while (0)
 
 /*	bb1.c */
 extern	int	outtyp;		/* output type */
+extern	int	critpath;	/* schedule by critical path? */
+extern	int	pipeline;	/* modulo schedule while loops? */
+extern	int	unroll;		/* copies of a counted while body */
+extern	int	jobs;		/* threads to schedule -p blocks on */
+extern	int	adder;		/* gate-level adder, ADDRIPPLE and so on */
+extern	int	buswidth;	/* bits per gate-level word */
+extern	char	*simin;		/* -x test vector file, or 0 */
 
 /*	bb2.C */
 extern	void	prog(void);	/* parser entry point */
@@ -129,6 +196,9 @@ extern	char	errbuf[513];	/* error message buffer */
 extern	int nextt(void);	/* get next token from input */
 extern	void error(char *fmat);
 extern	int need(int x, char *y);
+extern	void	taperec(tape_t *t);	/* record input into t */
+extern	void	tapeend(void);		/* stop recording */
+extern	void	tapeplay(tape_t *t, int last);	/* read t again */
 
 /*	bb4.C */
 extern	var	symtab[MAXV];	/* symbol table itself */
@@ -152,16 +222,39 @@ extern	tuple	*killop(var *v);
 extern	void	codegen(void);
 
 /*	bb6.c */
-extern	gate_t	gate[MAXGATES];
+extern	gate_t	*gate;
 extern	int	gatesp;
 extern	int	gatesneed;
-extern	bus_t	bus_zero;
-extern	bus_t	busop(opcode op, bus_t arg0, bus_t arg1);
-extern	bus_t	busconst(int v);
-extern	bus_t	busload(var *varg);
-extern	bus_t	busstore(int guard, var *varg, bus_t bus);
+extern	void	busvars(void);
+extern	void	busop(opcode op, int *r, int *arg0, int *arg1);
+extern	void	busconst(int *r, int v);
+extern	void	busknown(int *r, unsigned long long k0, unsigned long long k1);
+extern	void	busload(int *r, var *varg);
+extern	void	busstore(int *r, int guard, var *varg, int *bus);
 extern	int	stateguard(int state);
 extern	void	dumpgates(int haltstate);
 extern	void	buslab(int guard, int t);
-extern	void	bussel(int guard, bus_t bus, int t, int e);
+extern	void	bussel(int guard, int *bus, int t, int e);
+
+/*	bb7.c */
+extern	machine_t	machine;
+extern	void	machinit(int width);
+extern	int	machunit(char *name, int count, int busy);
+extern	void	machop(opcode op, int lat, int unit);
+extern	void	readmachine(char *file);
+
+/*	bb8.c */
+extern	int	workpool(int n, int *cost, void (*job)(int, int), void (*done)(void));
+
+/*	bb9.c */
+extern	out_t	out;		/* stdout */
+extern	void	outinit(out_t *o, FILE *f);
+extern	void	outflush(out_t *o);
+extern	void	outfree(out_t *o);
+extern	void	outroom(out_t *o, int k);
+extern	void	outw(out_t *o, char *s, int n);
+extern	void	outs(out_t *o, char *s);
+extern	void	outu(out_t *o, unsigned long long u);
+extern	void	outd(out_t *o, long long i);
+extern	void	outf(out_t *o, char *fmat, ...);
 
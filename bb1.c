@@ -8,6 +8,13 @@
 #include	"bb.h"
 
 int	outtyp = 0;	/* output type */
+int	critpath = 0;	/* schedule by critical path, not program order? */
+int	pipeline = 0;	/* modulo schedule while loops in -p output? */
+int	unroll = 1;	/* copies of a counted while body */
+int	jobs = 1;	/* threads to schedule -p blocks on */
+int	adder = ADDQUIET;	/* gate-level adder */
+int	buswidth = 8;	/* bits per gate-level word */
+char	*simin = 0;	/* -x test vector file */
 
 int
 main(register int argc, register char **argv)
@@ -18,11 +25,23 @@ main(register int argc, register char **argv)
 usage:
 		fprintf(stderr,
 			"Usage: %s {options}\n"
+			"-a r|k|b|h\tripple, Kogge-Stone, Brent-Kung or Han-Carlson gate-level adders,\n"
+			"\tprinting their gate count and depth on stderr\n"
+			"-b\tenable gate-level binary netlist output\n"
+			"-c\tenable gate-level SIMD C evaluator output\n"
 			"-d\tenable gate-level dot output\n"
 			"-g\tenable gate-level gate list output\n"
+			"-i file\tsimulate gate-level design on the test vectors in file\n"
+			"-j N\tschedule -p blocks on N threads\n"
+			"-l\tsoftware pipeline while loops in -p output\n"
+			"-m file\tschedule -p for the machine model in file\n"
 			"-p\tenable parallel word-level output\n"
+			"-r\trank -p schedule by critical path\n"
 			"-s\tenable sequential word-level output\n"
-			"-v\tenable gate-level Verilog output\n",
+			"-u N\tunroll counted while loops N times\n"
+			"-v\tenable gate-level Verilog output\n"
+			"-w N\tmake gate-level words N bits wide (default 8)\n"
+			"-x\tsimulate gate-level design on 64 test vectors\n",
 			argv[0]);
 		exit(1);
 	}
@@ -31,20 +50,65 @@ usage:
 		register char *p = argv[i];
 		if (*(p++) != '-') goto usage;
 		while (*p) switch (*(p++)) {
+		case 'a':
+			/* Adder kind is the next argument, one letter */
+			if (*p || (++i >= argc) || (argv[i][0] && argv[i][1])) goto usage;
+			switch (*argv[i]) {
+			case 'r': adder = ADDRIPPLE; break;
+			case 'k': adder = ADDKOGGE; break;
+			case 'b': adder = ADDBRENT; break;
+			case 'h': adder = ADDHAN; break;
+			default: goto usage;
+			}
+			break;
+		case 'b': outtyp |= OUTBIN; break;
+		case 'c': outtyp |= OUTEVAL; break;
 		case 'd': outtyp |= OUTDOT; break;
 		case 'g': outtyp |= OUTGATE; break;
+		case 'i':
+			/* Test vector file is the next argument */
+			if (*p || (++i >= argc)) goto usage;
+			simin = argv[i];
+			outtyp |= OUTSIM;
+			break;
+		case 'j':
+			/* Thread count is the next argument */
+			if (*p || (++i >= argc)) goto usage;
+			if ((jobs = atoi(argv[i])) < 1) goto usage;
+			break;
+		case 'l': pipeline = 1; break;
+		case 'm':
+			/* Model file is the next argument */
+			if (*p || (++i >= argc)) goto usage;
+			readmachine(argv[i]);
+			break;
 		case 'p': outtyp |= OUTPAR; break;
+		case 'r': critpath = 1; break;
 		case 's': outtyp |= OUTSEQ; break;
+		case 'u':
+			/* Unroll factor is the next argument */
+			if (*p || (++i >= argc)) goto usage;
+			if ((unroll = atoi(argv[i])) < 1) goto usage;
+			break;
 		case 'v': outtyp |= OUTVER; break;
+		case 'w':
+			/* Bus width is the next argument */
+			if (*p || (++i >= argc)) goto usage;
+			buswidth = atoi(argv[i]);
+			if ((buswidth < 1) || (buswidth > MAXWIDTH)) goto usage;
+			break;
+		case 'x': outtyp |= OUTSIM; break;
 		default: goto usage;
 		}
 	}
 	if (outtyp == 0) goto usage;
 
+	outinit(&out, stdout);	/* buffer standard output */
 	initv();	/* initialize var (symbol) table */
 	nextt();	/* prime the input stream */
 	newscope();	/* start scope for globals */
 	prog();		/* parse program */
 	codegen();	/* generate code */
+	outflush(&out);
 	exit(0);
 }
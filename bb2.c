@@ -14,6 +14,25 @@ static	label	*brksp = &(brklab[-1]);
 static	label	contlab[MAXLAB];
 static	label	*contsp = &(contlab[-1]);
 
+/*	while loop unrolling (-u)...
+	a loop like while (v < e) { ... v = v + k; ... }, where the
+	body sets v only there, not under an if, and changes nothing
+	e reads, is emitted as a loop running unroll copies of the
+	body while v + (unroll - 1) * k < e, then the loop as written
+	for the rest.  The loop is read once to check that, then
+	replayed from a tape for each copy.  v must not wrap.
+*/
+typedef struct {
+	int	t;		/* token */
+	var	*v;		/* its lookv */
+	konst	k;		/* its lookk */
+} utok_t;
+
+static	utok_t	*utok = 0;	/* tokens of the loop being checked */
+static	int	nutok = 0, maxutok = 0;
+static	var	*ivar = 0;	/* counter, while reading the unrolled test */
+static	konst	ivbump;		/* ... and what to add to it there */
+
 extern	void	prog(void);	/* parser entry point */
 static	void	decl(void);	/* variable declarations */
 static	void	stat(void);	/* statements */
@@ -26,6 +45,8 @@ static	tuple	*shift(void);
 static	tuple	*addsub(void);
 static	tuple	*muldiv(void);
 static	tuple	*unary(void);
+static	void	loop(void);	/* while loops */
+static	void	unrolled(void);
 static	label	newlab(int n);	/* create new labels */
 static	tuple	*helpmul(register tuple *t1, register tuple *t2);	/* generate in-line multiply code */
 static	tuple	*helpss(register opcode o, register tuple *t1, register tuple *t2);	/* generate in-line shift code */
@@ -85,7 +106,7 @@ decl(void)
 			}
 			need(']', "]");
 
-			if ((outtyp & (OUTDOT | OUTGATE | OUTVER)) && (p->dim > MAXDIM)) {
+			if ((outtyp & OUTBITS) && (p->dim > MAXDIM)) {
 				error("truncated array dimension too large for gate design");
 				p->dim = MAXDIM;
 			}
@@ -144,22 +165,12 @@ stat(void)
 		break;
 
 	case WHILE:
-		nextt();
-		{
-			register label clab = (*(++brksp) = newlab(1));
-			register label blab = (*(++brksp) = newlab(2));
-			register tuple *t;
-
-			labop(clab);
-			t = expr();
-			selop(t, blab+1, blab);
-			labop(blab+1);
-			stat();
-			selop(NULL, clab, clab);
-			labop(blab);
+		if (unroll > 1) {
+			unrolled();
+		} else {
+			nextt();
+			loop();
 		}
-		--brksp;
-		--contsp;
 		break;
 
 	case CONT:
@@ -190,7 +201,7 @@ stat(void)
 
 			/* look for subscript... */
 			if (nextt() == '[') {
-				if (outtyp & (OUTDOT | OUTGATE | OUTVER)) {
+				if (outtyp & OUTBITS) {
 					error("subscripted store not allowed for gate-level output");
 				}
 				nextt();
@@ -221,6 +232,243 @@ stat(void)
 	}
 }
 
+static void
+loop(void)
+{
+	/* while loop, with lookt on the test */
+	register label clab = (*(++contsp) = newlab(1));
+	register label blab = (*(++brksp) = newlab(2));
+	register tuple *t;
+
+	labop(clab);
+	t = expr();
+	selop(t, blab+1, blab);
+	labop(blab+1);
+	stat();
+	selop(NULL, clab, clab);
+	labop(blab);
+	--brksp;
+	--contsp;
+}
+
+static int
+ukeep(void)
+{
+	/* read a token, keeping a copy in utok */
+	if (nutok >= maxutok) {
+		maxutok = ((maxutok > 0) ? (2 * maxutok) : 256);
+		utok = ((utok_t *) realloc(utok, maxutok * sizeof(utok_t)));
+		if (utok == 0) {
+			error("out of memory for loop unrolling");
+			exit(1);
+		}
+	}
+	nextt();
+	utok[nutok].t = lookt;
+	utok[nutok].v = lookv;
+	utok[nutok].k = lookk;
+	++nutok;
+	return(lookt);
+}
+
+static void
+uscan(void)
+{
+	/* read the test and body of the while at lookt */
+	register int depth;
+
+	nutok = 0;
+	if (ukeep() != '(') return;
+	for (depth=1; depth>0; ) {
+		switch (ukeep()) {
+		case '(': ++depth; break;
+		case ')': --depth; break;
+		case EOF: return;
+		}
+	}
+	if (ukeep() == '{') {
+		for (depth=1; depth>0; ) {
+			switch (ukeep()) {
+			case '{': ++depth; break;
+			case '}': --depth; break;
+			case EOF: return;
+			}
+		}
+	} else {
+		while ((lookt != ';') && (lookt != EOF)) ukeep();
+	}
+}
+
+static int
+ustep(register var *v, register int lo, register int hi, register int b, register konst *step)
+{
+	/* Does the body from utok[b] on set v once, by a constant
+	   step, and leave utok[lo..hi] alone?
+	*/
+	register int i, j, k, depth = 0, n = 0;
+	register var *w;
+
+	for (i=lo; i<=hi; ++i) {
+		if ((utok[i].t == WORD) && (utok[i].v == v)) return(0);
+	}
+	for (i=b; i<nutok; ++i) {
+		switch (utok[i].t) {
+		case WHILE:
+		case BREAK:
+		case CONT:
+		case INT:
+			return(0);
+		case '{':
+			++depth;
+			break;
+		case '}':
+			--depth;
+			break;
+		case '=':
+			/* what is assigned? */
+			j = i - 1;
+			if (utok[j].t == ']') {
+				register int d = 0;
+
+				do {
+					if (utok[j].t == ']') ++d;
+					if (utok[j].t == '[') --d;
+				} while ((--j > b) && (d > 0));
+			}
+			if ((j < b) || (utok[j].t != WORD)) return(0);
+			w = utok[j].v;
+			for (k=lo; k<=hi; ++k) {
+				if ((utok[k].t == WORD) && (utok[k].v == w)) return(0);
+			}
+			if (w != v) break;
+
+			/* v = v + k; or v = v - k; at the top of the body */
+			if ((j != i - 1) ||
+			    (depth != ((utok[b].t == '{') ? 1 : 0)) ||
+			    ((j != b) &&
+			     (utok[j-1].t != '{') &&
+			     (utok[j-1].t != ';') &&
+			     (utok[j-1].t != '}')) ||
+			    (i + 4 >= nutok) ||
+			    (utok[i+1].t != WORD) || (utok[i+1].v != v) ||
+			    ((utok[i+2].t != '+') && (utok[i+2].t != '-')) ||
+			    (utok[i+3].t != CONST) || (utok[i+3].k == 0) ||
+			    (utok[i+4].t != ';')) return(0);
+			*step = ((utok[i+2].t == '+') ? utok[i+3].k : -utok[i+3].k);
+			++n;
+		}
+	}
+	return(n == 1);
+}
+
+static var *
+counted(register konst *step)
+{
+	/* Is the loop in utok ( v rel e ) or ( e rel v ), with v
+	   stepped toward e?  Returns v, or 0.
+	*/
+	register int i, r = 0, depth = 0;
+	register int up;
+
+	for (i=1; i<nutok; ++i) {
+		switch (utok[i].t) {
+		case '(':
+			++depth;
+			break;
+		case ')':
+			if (--depth < 0) goto test;
+			break;
+		case '<':
+		case '>':
+		case LE:
+		case GE:
+			if (depth > 0) break;
+			if (r > 0) return(0);
+			r = i;
+			break;
+		case '|':
+		case '^':
+		case '&':
+		case EQ:
+		case NE:
+			if (depth == 0) return(0);
+		}
+	}
+	return(0);
+
+test:
+	/* utok[i] closes the test, and utok[r] is its only relation */
+	if ((r == 0) || (i + 1 >= nutok)) return(0);
+	up = ((utok[r].t == '<') || (utok[r].t == LE));
+	if ((r == 2) && (utok[1].t == WORD) &&
+	    ustep(utok[1].v, r+1, i-1, i+1, step) &&
+	    (up == (*step > 0))) return(utok[1].v);
+	if ((r == i - 2) && (utok[i-1].t == WORD) &&
+	    ustep(utok[i-1].v, 1, r-1, i+1, step) &&
+	    (up == (*step < 0))) return(utok[i-1].v);
+	return(0);
+}
+
+static void
+uskip(void)
+{
+	/* skip the parenthesized test at lookt */
+	register int depth = 0;
+
+	do {
+		if (lookt == '(') ++depth;
+		if (lookt == ')') --depth;
+		if (lookt == EOF) return;
+		nextt();
+	} while (depth > 0);
+}
+
+static void
+unrolled(void)
+{
+	/* while loop at lookt, unrolled if it counts by a constant */
+	tape_t tape;
+	register var *v;
+	register int i;
+	konst step;
+
+	tape.c = 0;
+	tape.max = 0;
+	taperec(&tape);
+	uscan();
+	tapeend();
+
+	if ((v = counted(&step)) != 0) {
+		register label clab = newlab(1);
+		register label blab = newlab(2);
+		register tuple *t;
+
+		/* Are there unroll more iterations to go? */
+		labop(clab);
+		tapeplay(&tape, 0);
+		ivar = v;
+		ivbump = ((unroll - 1) * step);
+		t = expr();
+		ivar = 0;
+		selop(t, blab+1, blab);
+
+		/* If so, do them as one body */
+		labop(blab+1);
+		for (i=0; i<unroll; ++i) {
+			tapeplay(&tape, 0);
+			uskip();
+			stat();
+		}
+		selop(NULL, clab, clab);
+		labop(blab);
+	}
+
+	/* The loop as written does the rest, or all of it */
+	tapeplay(&tape, 1);
+	loop();
+	free(tape.c);
+}
+
 static tuple *
 expr(void)
 {
@@ -425,13 +673,16 @@ unary(void)
 			/* look for subscript... */
 			if (nextt() == '[') {
 				register tuple *t;
-				if (outtyp & (OUTDOT | OUTGATE | OUTVER)) {
+				if (outtyp & OUTBITS) {
 					error("subscripted load not allowed for gate-level output");
 				}
 				nextt();
 				t = expr();
 				need(']', "]");
 				return( ldxop(v, t) );
+			} else if (v == ivar) {
+				/* the counter, some iterations on */
+				return( binop(ADD, ldop(v), cop(ivbump)) );
 			} else {
 				return( ldop(v) );
 			}
@@ -485,13 +736,17 @@ helpmul(register tuple *t1, register tuple *t2)
 				t3 = binop(ADD, t3, t);
 			}
 		}
+	} else if (outtyp & OUTBITS) {
+		/* gate-level multiplier does it in one go */
+		t3 = binop(MUL, t1, t2);
 	} else {
 		/* handle multiply by a non-constant... */
 		for (bit=0; bit<32; ++bit) {
-			t = binop(AND, t1, cop(1));
+			t = binop(AND, t2, cop(1));
 			t = binop(SUB, cop(0), t);
-			t = binop(AND, t, t2);
+			t = binop(AND, t, t1);
 			t3 = binop(ADD, t3, t);
+			t1 = binop(SSL, t1, cop(1));
 			t2 = binop(SSR, t2, cop(1));
 		}
 	}
@@ -521,10 +776,10 @@ helpss(register opcode o, register tuple *t1, register tuple *t2)
 
 			t = binop(AND, t2, cop(1));
 			t = binop(SUB, cop(0), t);
-			t4 = binop(AND, t1, t);
+			t4 = binop(o, t1, cop(mask[bit]));
+			t4 = binop(AND, t4, t);
 			t = binop(XOR, t, cop(-1));
-			t3 = binop(o, t1, cop(mask[bit]));
-			t3 = binop(AND, t3, t);
+			t3 = binop(AND, t1, t);
 			t1 = binop(OR, t3, t4);
 			t2 = binop(SSR, t2, cop(1));
 		}
@@ -15,18 +15,108 @@ static	int	lookc = ' ';	/* next character of input */
 	char	errbuf[513];	/* error message buffer */
 static	int	line = 0;	/* line number */
 
+/*	Input tapes for loop unrolling...
+	taperec() copies every character read into a tape until
+	tapeend(), and tapeplay() puts a copy of a tape back on the
+	input.  A replay that is not the last reads as EOF past its
+	end; the last one runs on into whatever input follows, which
+	is where the recording stopped.
+*/
+typedef struct _replay {
+	int	*c;		/* characters to read again */
+	int	n, pos;
+	int	wall;		/* EOF at the end, not the input below? */
+	struct _replay *below;	/* input underneath this one */
+} replay_t;
+
+static	replay_t	*replay = 0;	/* innermost replay, if any */
+static	tape_t	*rec = 0;	/* tape being recorded, if any */
+
+static void
+tapeput(register tape_t *t, int c)
+{
+	if (t->n >= t->max) {
+		t->max = ((t->max > 0) ? (2 * t->max) : 1024);
+		t->c = ((int *) realloc(t->c, t->max * sizeof(int)));
+		if (t->c == 0) {
+			error("out of memory for loop unrolling");
+			exit(1);
+		}
+	}
+	t->c[(t->n)++] = c;
+}
+
+static void
+popreplay(void)
+{
+	register replay_t *r = replay;
+
+	replay = r->below;
+	free(r->c);
+	free(r);
+}
+
 static int
 nextc(void)
 {
 	if (lookc == EOF) return(EOF);
-	switch (lookc = getchar()) {
-	case '\n':
-		/* another source line... */	
-		++line;
+	for (;;) {
+		if (replay == 0) {
+			switch (lookc = getchar()) {
+			case '\n':
+				/* another source line... */	
+				++line;
+			}
+			break;
+		}
+		if (replay->pos < replay->n) {
+			lookc = replay->c[(replay->pos)++];
+			break;
+		}
+		if (replay->wall) return(lookc = EOF);
+		popreplay();
 	}
+	if (rec) tapeput(rec, lookc);
 	return(lookc);
 }
 
+void
+taperec(register tape_t *t)
+{
+	/* record from the character after the current token */
+	t->n = 0;
+	tapeput(t, lookc);
+	rec = t;
+}
+
+void
+tapeend(void)
+{
+	rec = 0;
+}
+
+void
+tapeplay(register tape_t *t, int last)
+{
+	/* read t again, starting with its first token */
+	register replay_t *r;
+
+	if (replay && replay->wall) popreplay();
+	if (((r = ((replay_t *) malloc(sizeof(replay_t)))) == 0) ||
+	    ((r->c = ((int *) malloc(t->n * sizeof(int)))) == 0)) {
+		error("out of memory for loop unrolling");
+		exit(1);
+	}
+	memcpy(r->c, t->c, t->n * sizeof(int));
+	r->n = t->n;
+	r->pos = 0;
+	r->wall = !last;
+	r->below = replay;
+	replay = r;
+	lookc = ' ';
+	nextt();
+}
+
 int
 nextt(void)
 {
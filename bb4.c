@@ -141,11 +141,8 @@ initv(void)
 	/* initialize symbol table...
 	*/
 	register var *p = &(symtab[MAXV-1]);
-	register int i;
 
 	do {
-		/* Initialize all busses to "self" */
-		forbusdim (i) p->bus.wire[i] = VARPTR2NUM(p) + i;
 		p->type = UNDEF;
 	} while (--p >= &(symtab[0]));
 
@@ -163,7 +160,6 @@ initv(void)
 	p->dim = 1;
 	p->deflev = 0;
 	p->defblk = 0;
-	forbusdim (i) p->bus.wire[i] = 0;
 }
 
 static char *
@@ -13,47 +13,334 @@ static	tuple	code = {
 
 static	tuple	*zero, *negone;
 
+static	int	renum = 0;	/* seq stale since a rmtuple()? */
+static	__thread out_t	*cgout;	/* where listings go, per thread for -j */
+
+static void
+renumber(void)
+{
+	/* make seq the int position of every tuple again */
+	register int i = 0;
+	register tuple *p;
+
+	for (p=code.next; p!=&code; p=p->next) p->seq = i++;
+	renum = 0;
+}
+
 static int
 ttoi(register tuple *t)
 {
 	/* tuple pointer to int position */
-	register int i = 0;
-	register tuple *p = code.next;
+	if (t == 0) return(-1);
+	if (renum) renumber();
+	return(t->seq);
+}
 
-	while (p != &code) {
-		if (p == t) return(i);
-		++i;
-		p = p->next;
-	}
+static void
+cgbin(char *s, tuple *p)
+{
+	outs(cgout, s);
+	outc(cgout, '(');
+	outd(cgout, ttoi(p->targ[0]));
+	outs(cgout, ", ");
+	outd(cgout, ttoi(p->targ[1]));
+	outc(cgout, ')');
+}
 
-	return(-1);
+static void
+cgsel(register tuple *p)
+{
+	outs(cgout, "sel(");
+	outd(cgout, ttoi(p->targ[0]));
+	outs(cgout, ", ");
+	outd(cgout, p->larg[0]);
+	outs(cgout, ", ");
+	outd(cgout, p->larg[1]);
+	outc(cgout, ')');
 }
 
+/*	Tuple arena...
+	tuples are carved out of TCHUNK-sized chunks and rmtuple() puts
+	them on a free list, so there is no malloc/free per tuple.  The
+	chunks are linked through their first tuple and freed at exit.
+*/
+#define	TCHUNK	4096
+
+static	tuple	*tfree = 0;	/* free list, linked through next */
+static	tuple	*tchunks = 0;	/* all chunks, linked through next */
+static	int	tleft = 0;	/* unused tuples at the end of tchunks */
+
 static void
-cgbin(char *s, tuple *p)
+freetuples(void)
+{
+	/* release the whole arena */
+	register tuple *p;
+
+	while ((p = tchunks) != 0) {
+		tchunks = p->next;
+		free((char *) p);
+	}
+	tfree = 0;
+	tleft = 0;
+}
+
+static tuple *
+newtuple(void)
 {
-	printf("%s(%d, %d)", s, ttoi(p->targ[0]), ttoi(p->targ[1]));
+	/* get a tuple from the free list or the arena */
+	register tuple *p;
+
+	if ((p = tfree) != 0) {
+		tfree = p->next;
+		return(p);
+	}
+
+	if (tleft == 0) {
+		if (tchunks == 0) atexit(freetuples);
+		p = ((tuple *) malloc((TCHUNK + 1) * sizeof(tuple)));
+		if (p == 0) {
+			error("out of memory for tuples");
+			exit(1);
+		}
+		p->next = tchunks;
+		tchunks = p;
+		tleft = TCHUNK;
+	}
+
+	return(tchunks + (tleft--));
 }
 
 static tuple *
 mktuple(void)
 {
 	/* make a tuple and link it into code */
-	register tuple *p = ((tuple *) malloc(sizeof(tuple)));
+	register tuple *p = newtuple();
 
+	memset(p, 0, sizeof(tuple));
 	p->next = &code;
 	(p->prev = code.prev)->next = p;
+
+	/* Position follows the old tail; still in order even if stale */
+	p->seq = ((p->prev == &code) ? 0 : ((p->prev)->seq + 1));
 	return(code.prev = p);
 }
 
+/*	Value numbering for CSE and the constant pool...
+	hash of (oarg, targ[0], targ[1]), or of the value for a CONST, over
+	the tuples of the current block, chained through hnext.  Buckets are
+	stamped with the block number they were filled in, so labop() starts
+	over by bumping blkno.
+*/
+static	tuple	**vntab = 0;	/* hash buckets */
+static	int	*vnblk = 0;	/* block number of each bucket */
+static	int	vnsize = 0;	/* number of buckets, a power of 2 */
+static	int	vncount = 0;	/* tuples entered for this block */
+static	int	blkno = 1;	/* current block number */
+
+static int
+vnhash(opcode o, tuple *t1, tuple *t2, konst c)
+{
+	/* Mix opcode and operands into a bucket index */
+	register unsigned long h;
+
+	h = (((unsigned long) t1) * 0x9e3779b1UL);
+	h ^= (((unsigned long) t2) * 0x85ebca77UL);
+	h ^= (((unsigned long) c) * 0x27d4eb2fUL);
+	h ^= (((unsigned long) o) * 0xc2b2ae3dUL);
+	h ^= (h >> 29);
+	return(h & (vnsize - 1));
+}
+
+static int
+vnhashof(register tuple *p)
+{
+	/* Bucket of tuple p; only a CONST's value counts */
+	if (p->oarg == CONST) return(vnhash(CONST, 0, 0, p->carg));
+	return(vnhash(p->oarg, p->targ[0], p->targ[1], 0));
+}
+
+static tuple *
+vnfind(opcode o, tuple *t1, tuple *t2, konst c)
+{
+	/* Find tuple computing o(t1, t2), or CONST c, in this block */
+	register tuple *p;
+	register int h;
+
+	if (vnsize == 0) return(0);
+	h = vnhash(o, t1, t2, c);
+	if (vnblk[h] != blkno) return(0);
+	for (p=vntab[h]; p; p=p->hnext) {
+		if (p->oarg != o) continue;
+		if ((o == CONST) ?
+		    (p->carg == c) :
+		    ((p->targ[0] == t1) && (p->targ[1] == t2))) {
+			return(p);
+		}
+	}
+	return(0);
+}
+
+static void
+vnenter(register tuple *p)
+{
+	/* Enter p in the value numbering table */
+	register int h;
+
+	if (vncount >= vnsize) {
+		/* Grow, keeping only this block's entries */
+		register tuple **otab = vntab;
+		register int *oblk = vnblk;
+		register int osize = vnsize;
+		register int i;
+		register tuple *q;
+
+		vnsize = ((vnsize) ? (vnsize * 2) : 1024);
+		vntab = ((tuple **) calloc(vnsize, sizeof(tuple *)));
+		vnblk = ((int *) calloc(vnsize, sizeof(int)));
+		vncount = 0;
+		for (i=0; i<osize; ++i) {
+			if (oblk[i] == blkno) {
+				while ((q = otab[i]) != 0) {
+					otab[i] = q->hnext;
+					vnenter(q);
+				}
+			}
+		}
+		free(otab);
+		free(oblk);
+	}
+
+	h = vnhashof(p);
+	if (vnblk[h] != blkno) {
+		vntab[h] = 0;
+		vnblk[h] = blkno;
+	}
+	p->hnext = vntab[h];
+	vntab[h] = p;
+	++vncount;
+}
+
+static void
+vnremove(register tuple *p)
+{
+	/* Take p out of the value numbering table, if there */
+	register tuple **pp;
+	register int h;
+
+	if (vnsize == 0) return;
+	h = vnhashof(p);
+	if (vnblk[h] != blkno) return;
+	for (pp=&(vntab[h]); *pp; pp=&((*pp)->hnext)) {
+		if (*pp == p) {
+			*pp = p->hnext;
+			--vncount;
+			return;
+		}
+	}
+}
+
+/*	Memory accesses of each var in the current block...
+	LDX/STX tuples of the same var are doubly linked through
+	vprev/vnext, newest at v->acc; v->accblk says which block that is.
+*/
+static tuple *
+lastacc(register var *v)
+{
+	/* Latest LDX/STX of v in this block */
+	return((v->accblk == blkno) ? v->acc : 0);
+}
+
+static void
+accenter(register tuple *p)
+{
+	/* Link new LDX/STX p onto its var's chain */
+	register var *v = p->varg;
+
+	if ((p->vprev = lastacc(v)) != 0) (p->vprev)->vnext = p;
+	p->vnext = 0;
+	v->acc = p;
+	v->accblk = blkno;
+}
+
+static void
+accremove(register tuple *p)
+{
+	/* Unlink LDX/STX p from its var's chain */
+	if (p->vprev) (p->vprev)->vnext = p->vnext;
+	if (p->vnext) {
+		(p->vnext)->vprev = p->vprev;
+	} else if ((p->varg)->acc == p) {
+		(p->varg)->acc = p->vprev;
+	}
+}
+
 static void
 rmtuple(register tuple *p)
 {
 	/* remove this tuple */
 
+	vnremove(p);
+	switch (p->oarg) {
+	case LDX:
+	case STX:
+		accremove(p);
+	}
 	(p->prev)->next = p->next;
 	(p->next)->prev = p->prev;
-	free((char *) p);
+	p->next = tfree;
+	tfree = p;
+	renum = 1;
+}
+
+/*	Dead code...
+	refs counts the live tuples using this one, plus one for an STX,
+	LAB, SEL or KILL, which are live by themselves until a later store
+	or kill clears that.  Anything that may have dropped to no refs
+	waits on dlist; dead() removes what really did and releases its
+	operands in turn, so the work is bounded by what it removes.
+*/
+static	tuple	*dlist = &code;	/* dead candidates, linked through dnext */
+
+static void
+maybedead(register tuple *p)
+{
+	/* Have dead() check p */
+	if (p->dnext == 0) {
+		p->dnext = dlist;
+		dlist = p;
+	}
+}
+
+static void
+refarg(register tuple *t, register int d)
+{
+	/* Count (d = 1) or release (d = -1) a use of t */
+	if (t && ((t->refs += d) <= 0)) maybedead(t);
+}
+
+static void
+refargs(register tuple *p, register int d)
+{
+	/* Count or release the uses p makes of other tuples */
+	switch (p->oarg) {
+	case ADD:
+	case SUB:
+	case AND:
+	case OR:
+	case XOR:
+	case GT:
+	case GE:
+	case EQ:
+	case SSL:
+	case SSR:
+	case MUL:
+	case STX:
+		refarg(p->targ[1], d);
+		/* Fall through... */
+	case LDX:
+	case SEL:
+		refarg(p->targ[0], d);
+	}
 }
 
 tuple *
@@ -75,6 +362,7 @@ binop(opcode o, tuple *t1, tuple *t2)
 	case EQ:	return(cop(t1->carg == t2->carg));
 	case SSL:	return(cop(t1->carg << t2->carg));
 	case SSR:	return(cop(t1->carg >> t2->carg));
+	case MUL:	return(cop(t1->carg * t2->carg));
 	}
 
 	/* Normalize operand order for commutative ops */
@@ -84,10 +372,11 @@ binop(opcode o, tuple *t1, tuple *t2)
 	case OR:
 	case XOR:
 	case EQ:
+	case MUL:
 		/* Forces CONST 0 or -1 into second position so it's the
 		   same place as for SUB
 		*/
-		if (ttoi(t1) < ttoi(t2)) {
+		if (t1->seq < t2->seq) {
 			tuple *t = t1;
 			t1 = t2;
 			t2 = t;
@@ -137,14 +426,9 @@ binop(opcode o, tuple *t1, tuple *t2)
 	}
 
 	/* Common subexpression elimination */
-	p = code.prev;
-	while ((p != t1) && (p != t2)) {
-		/* Haven't gone back to either operand yet */
-		if ((p->oarg == o) && (p->targ[0] == t1) && (p->targ[1] == t2)) {
-			/* Redundant with this */
-			return(p);
-		}
-		p = p->prev;
+	if ((p = vnfind(o, t1, t2, 0)) != 0) {
+		/* Redundant with this */
+		return(p);
 	}
 
 	/* Make a new tuple */
@@ -152,6 +436,9 @@ binop(opcode o, tuple *t1, tuple *t2)
 	p->oarg = o;
 	p->targ[0] = t1;
 	p->targ[1] = t2;
+	vnenter(p);
+	refargs(p, 1);
+	maybedead(p);
 	return(p);
 }
 
@@ -160,21 +447,18 @@ cop(konst c)
 {
 	register tuple *p;
 
-	/* Have we seen this before? */
-	p = code.prev;
-	while ((p != &code) && (p->oarg != LAB)) {
-		/* Haven't gone back to start of block yet */
-		if ((p->oarg == CONST) && (p->carg == c)) {
-			/* Redundant with this */
-			return(p);
-		}
-		p = p->prev;
+	/* Have we seen this before in this block? */
+	if ((p = vnfind(CONST, 0, 0, c)) != 0) {
+		/* Redundant with this */
+		return(p);
 	}
 
 	/* Need new tuple */
 	p = mktuple();
 	p->oarg = CONST;
 	p->carg = c;
+	vnenter(p);
+	maybedead(p);
 	return(p);
 }
 
@@ -236,9 +520,7 @@ ldxop(var *v, tuple *t)
 	register tuple *p;
 
 	/* Value propagation */
-	p = code.prev;
-	while ((p != &code) && (p->oarg != LAB)) {
-		if (p->varg == v)
+	for (p=lastacc(v); p; p=p->vprev) {
 		switch (p->oarg) {
 		case STX:
 			switch (sameval(t, p->targ[0])) {
@@ -252,7 +534,6 @@ ldxop(var *v, tuple *t)
 			/* Did this before? */
 			if (t == p->targ[0]) return(p);
 		}
-		p = p->prev;
 	}
 
 killed:
@@ -261,6 +542,9 @@ killed:
 	p->oarg = LDX;
 	p->varg = v;
 	p->targ[0] = t;
+	accenter(p);
+	refargs(p, 1);
+	maybedead(p);
 	return(p);
 }
 
@@ -276,15 +560,14 @@ stxop(var *v, tuple *t1, tuple *t2)
 	register tuple *p;
 
 	/* Unref any earlier dead STX */
-	p = code.prev;
-	while ((p != &code) && (p->oarg != LAB)) {
-		if (p->varg == v)
+	for (p=lastacc(v); p; p=p->vprev) {
 		switch (p->oarg) {
 		case STX:
 			switch (sameval(t1, p->targ[0])) {
 			case SAME:
 				/* This guy is no longer live */
 				p->refs = 0;
+				maybedead(p);
 				/* Fall through... */
 			case MAYBE:
 				goto killed;
@@ -295,8 +578,6 @@ stxop(var *v, tuple *t1, tuple *t2)
 				goto killed;
 			}
 		}
-
-		p = p->prev;
 	}
 
 killed:
@@ -306,157 +587,732 @@ killed:
 	p->varg = v;
 	p->targ[0] = t1;
 	p->targ[1] = t2;
+	accenter(p);
+	refargs(p, 1);
 	return(p);
 }
 
 void
 dead(void)
 {
-	register tuple *p = code.prev;
-
-	while ((p != &code) && (p->oarg != LAB)) {
-		register tuple *q = p->prev;
+	/* Remove tuples nothing live uses */
+	register tuple *p;
 
-		if (p->refs > 0)
-		switch (p->oarg) {
-		case ADD:
-		case SUB:
-		case AND:
-		case OR:
-		case XOR:
-		case GT:
-		case GE:
-		case EQ:
-		case SSL:
-		case SSR:
-			++((p->targ[0])->refs);
-			++((p->targ[1])->refs);
-		case CONST:
-			break;
-		case STX:
-			++((p->targ[1])->refs);
-			/* Fall through... */
-		case LDX:
-			/* inc index ref */
-			++((p->targ[0])->refs);
-			/* Fall through... */
-		case LAB:
-			break;
-		case SEL:
-			/* If conditional, ref that */
-			if (p->targ[0]) {
-				++((p->targ[0])->refs);
-			}
-			break;
-		case KILL:
-			break;
-		default:
-			printf("{bad opcode %d}", p->oarg);
-		}
-		else {
-			/* Remove tuple */
+	while ((p = dlist) != &code) {
+		dlist = p->dnext;
+		p->dnext = 0;
+		if (p->refs <= 0) {
+			refargs(p, -1);
 			rmtuple(p);
 		}
-
-		p = q;
 	}
 }
 
-tuple *
-labop(label l)
-{
-	register tuple *p;
-
-	dead();
-
-	p = mktuple();
-	p->refs = 1;
-	p->oarg = LAB;
-	p->larg[0] = l;
-
-	/* Pre-install 0 and -1 in this block */
-	zero = cop(0);
-	negone = cop(-1);
+/*	Control flow graph...
+	a block starts at the top of the code, at a LAB, or right
+	after a SEL, and runs up to the next of those.  cfgbuild()
+	numbers the tuples, cuts the code into blocks (kept in code
+	order, so block b+1 is where b falls through to), links each
+	block to where its SEL or fall through goes and back, orders
+	what the top reaches in reverse postorder and finds immediate
+	dominators by iterating over that order until they settle.
+	Anything that adds or removes tuples makes it stale, so build
+	it again afterward.
+*/
+static	block_t	*cfg = 0;	/* the blocks, in code order */
+static	int	cfgn = 0;	/* how many */
+static	int	*cfgorder = 0;	/* reached blocks in reverse postorder */
+static	int	cfgreached = 0;	/* how many are reached */
+static	int	*cfgpreds = 0;	/* all the pred lists, end to end */
 
-	return(p);
+static void
+cfgfree(void)
+{
+	/* Forget the graph */
+	free(cfg);
+	free(cfgorder);
+	free(cfgpreds);
+	cfg = 0;
+	cfgorder = (cfgpreds = 0);
+	cfgn = (cfgreached = 0);
 }
 
-tuple *
-selop(tuple *t, label l1, label l2)
+static void
+cfgsucc(register block_t *b, register int s)
 {
-	register tuple *p = mktuple();
-	p->refs = 1;
-	p->oarg = SEL;
-	p->larg[0] = l1;
-	p->larg[1] = l2;
-	p->targ[0] = t;
+	/* Block b can go to block s */
+	if ((s < 0) || ((b->nsucc > 0) && (b->succ[0] == s))) return;
+	b->succ[b->nsucc++] = s;
+}
 
-	/* Simplifications */
-	if (l1 == l2) {
-		p->targ[0] = 0;
-	} else if (t == zero) {
-		p->targ[0] = 0;
-		p->larg[0] = l2;
-	} else if (t && (t->oarg == CONST)) {
-		p->targ[0] = 0;
-		p->larg[1] = l1;
-	} else {
-		/* Need condition evaluated */
-		++(t->refs);
+static int
+cfgmeet(register int a, register int b)
+{
+	/* Closest block dominating both a and b */
+	while (a != b) {
+		while (cfg[a].rpo > cfg[b].rpo) a = cfg[a].idom;
+		while (cfg[b].rpo > cfg[a].rpo) b = cfg[b].idom;
 	}
+	return(a);
+}
 
-	dead();
-
-	return(p);
+static int
+cfgdom(register int a, register int b)
+{
+	/* Does block a dominate block b? */
+	if (cfg[b].idom < 0) return(0);
+	for (;;) {
+		if (b == a) return(1);
+		if (b == cfg[b].idom) return(0);
+		b = cfg[b].idom;
+	}
 }
 
-tuple *
-killop(var *v)
+static void
+cfgbuild(void)
 {
+	/* Cut the code into blocks and link them up */
 	register tuple *p;
+	register block_t *b;
+	register int i, j, k, n;
+	int *labblk, *stack, *edge, maxlab = 0, ntup = 0, changed;
+
+	cfgfree();
+	for (p=code.next; p!=&code; p=p->next) {
+		p->seq = ntup++;
+		if ((p->oarg == LAB) && (p->larg[0] > maxlab)) maxlab = p->larg[0];
+	}
+	renum = 0;
+	cfg = ((block_t *) malloc((ntup + 1) * sizeof(block_t)));
+	cfgorder = ((int *) malloc((ntup + 1) * sizeof(int)));
+	cfgpreds = ((int *) malloc(((2 * ntup) + 1) * sizeof(int)));
+	labblk = ((int *) malloc((maxlab + 1) * sizeof(int)));
+	stack = ((int *) malloc((ntup + 1) * sizeof(int)));
+	edge = ((int *) malloc((ntup + 1) * sizeof(int)));
+	if (!cfg || !cfgorder || !cfgpreds || !labblk || !stack || !edge) {
+		error("out of memory for control flow graph");
+		exit(1);
+	}
 
-	/* Unref any earlier dead STX */
-	p = code.prev;
-	while ((p != &code) && (p->oarg != LAB)) {
-		if (p->varg == v)
+	/* Blocks and where each label is */
+	for (i=0; i<=maxlab; ++i) labblk[i] = -1;
+	b = 0;
+	for (p=code.next; p!=&code; p=p->next) {
+		if ((p == code.next) || (p->oarg == LAB) ||
+		    ((p->prev)->oarg == SEL)) {
+			b = &(cfg[cfgn++]);
+			b->first = p;
+			b->sel = 0;
+			b->nsucc = (b->npred = 0);
+			b->rpo = (b->idom = -1);
+		}
+		b->last = p;
 		switch (p->oarg) {
-		case STX:
-			/* This guy is no longer live */
-			p->refs = 0;
+		case LAB:
+			labblk[p->larg[0]] = cfgn - 1;
 			break;
-		case LDX:
-			goto killed;
+		case SEL:
+			b->sel = p;
 		}
+	}
 
-		p = p->prev;
+	/* Successors, then predecessors */
+	for (i=0; i<cfgn; ++i) {
+		b = &(cfg[i]);
+		if ((p = b->sel) == 0) {
+			if ((i + 1) < cfgn) cfgsucc(b, i + 1);
+		} else {
+			cfgsucc(b, labblk[p->larg[0]]);
+			if (p->targ[0]) cfgsucc(b, labblk[p->larg[1]]);
+		}
+		for (j=0; j<b->nsucc; ++j) ++(cfg[b->succ[j]].npred);
+	}
+	for (i=0, n=0; i<cfgn; ++i) {
+		cfg[i].pred = &(cfgpreds[n]);
+		n += cfg[i].npred;
+		cfg[i].npred = 0;
+	}
+	for (i=0; i<cfgn; ++i) {
+		for (j=0; j<cfg[i].nsucc; ++j) {
+			b = &(cfg[cfg[i].succ[j]]);
+			b->pred[b->npred++] = i;
+		}
 	}
 
-killed:
-	p = mktuple();
-	p->refs = 1;
-	p->oarg = KILL;
-	p->varg = v;
-	return(p);
+	/* Depth first from the top; postorder fills cfgorder backward */
+	cfgreached = 0;
+	if (cfgn > 0) {
+		n = cfgn;
+		k = 0;
+		stack[k] = 0;
+		edge[k++] = 0;
+		cfg[0].rpo = 0;
+		while (k > 0) {
+			b = &(cfg[i = stack[k - 1]]);
+			if (edge[k - 1] < b->nsucc) {
+				j = b->succ[edge[k - 1]++];
+				if (cfg[j].rpo < 0) {
+					cfg[j].rpo = 0;
+					stack[k] = j;
+					edge[k++] = 0;
+				}
+			} else {
+				cfgorder[--n] = i;
+				--k;
+			}
+		}
+		cfgreached = cfgn - n;
+		memmove(cfgorder, &(cfgorder[n]), cfgreached * sizeof(int));
+		for (i=0; i<cfgreached; ++i) cfg[cfgorder[i]].rpo = i;
+
+		/* Immediate dominators */
+		cfg[0].idom = 0;
+		do {
+			changed = 0;
+			for (i=1; i<cfgreached; ++i) {
+				b = &(cfg[cfgorder[i]]);
+				for (j=0, n=-1; j<b->npred; ++j) {
+					if ((k = b->pred[j]) == cfgorder[i]) continue;
+					if (cfg[k].idom < 0) continue;
+					n = ((n < 0) ? k : cfgmeet(k, n));
+				}
+				if (b->idom != n) {
+					b->idom = n;
+					changed = 1;
+				}
+			}
+		} while (changed);
+	}
+	free(labblk);
+	free(stack);
+	free(edge);
 }
 
-void
-show(register tuple *p)
+/*	Global constant propagation...
+	the value numbering above forgets everything at each LAB.
+	globalprop() follows the blocks along their SEL and fall
+	through edges, tracking which var elements (var, constant
+	index) hold a known constant, or a copy of another element,
+	on every path in, until nothing changes.  A SEL whose test
+	turns out constant only passes facts along the edge it takes.
+	Then loads of known elements and what they fold into become
+	CONST tuples, loads of copies load the original instead,
+	constant tests become plain jumps, and each block keeps one
+	tuple per constant and per load; dead() clears out what that
+	orphans.  A copy is a fact about two vars, not a tuple value,
+	so it can cross a LAB where a tuple cannot.
+*/
+#define	GPTOP	0		/* not reached yet */
+#define	GPCONST	1		/* known constant */
+#define	GPNAC	2		/* not a constant */
+#define	GPCOPY	3		/* same as element val */
+#define	GPMAXFACTS	(1 << 24)	/* blocks times elements we track */
+
+typedef struct {
+	var	*v;		/* element of var v ... */
+	konst	x;		/* ... at index x */
+} gpelem_t;
+
+static	gpelem_t	*gp_elem;	/* tracked elements */
+static	int	*gp_hash;		/* element number + 1, by hash */
+static	int	gp_nelem, gp_hsize;
+static	char	*gp_kind;		/* in facts, gp_nelem per block */
+static	konst	*gp_val;
+static	char	*gp_tkind;		/* lattice value of each tuple */
+static	konst	*gp_tval;
+static	int	*gp_stamp;		/* seq of each element's last store */
+static	char	*gp_copied;		/* 1 if an element was ever copied */
+static	tuple	**gp_fwd;		/* earlier load to use instead */
+
+static int
+gpslot(register var *v, register konst x, register int make)
 {
-	printf("%d\t", ttoi(p));
+	/* Element number of v[x], or -1 if not tracked */
+	register unsigned long h;
 
-	switch (p->oarg) {
-	case ADD:
-		cgbin("add", p);
-		break;
-	case SUB:
-		cgbin("sub", p);
-		break;
-	case AND:
-		cgbin("and", p);
-		break;
-	case OR:
-		cgbin("or", p);
-		break;
+	h = ((((unsigned long) v) * 0x9e3779b1UL) ^ (((unsigned long) x) * 0x85ebca77UL));
+	for (h&=(gp_hsize-1); gp_hash[h]; h=((h + 1) & (gp_hsize - 1))) {
+		register gpelem_t *e = &(gp_elem[gp_hash[h] - 1]);
+
+		if ((e->v == v) && (e->x == x)) return(gp_hash[h] - 1);
+	}
+	if (!make) return(-1);
+	gp_elem[gp_nelem].v = v;
+	gp_elem[gp_nelem].x = x;
+	gp_hash[h] = ++gp_nelem;
+	return(gp_nelem - 1);
+}
+
+static int
+gpfold(register opcode o, register konst a, register konst b, register konst *c)
+{
+	/* What binop() folds o(a, b) to; 0 if it does not */
+	switch (o) {
+	case ADD:	*c = (a + b); break;
+	case SUB:	*c = (a - b); break;
+	case AND:	*c = (a & b); break;
+	case OR:	*c = (a | b); break;
+	case XOR:	*c = (a ^ b); break;
+	case GT:	*c = (a > b); break;
+	case GE:	*c = (a >= b); break;
+	case EQ:	*c = (a == b); break;
+	case SSL:	*c = (a << b); break;
+	case SSR:	*c = (a >> b); break;
+	case MUL:	*c = (a * b); break;
+	default:	return(0);
+	}
+	return(1);
+}
+
+static int
+gparg(register tuple *t, register tuple *first, register konst *c)
+{
+	/* Lattice value of operand t of a tuple in the block at first */
+	if (t->oarg == CONST) {
+		*c = t->carg;
+		return(GPCONST);
+	}
+	if ((t->seq < first->seq) || (gp_tkind[t->seq] == GPTOP)) return(GPNAC);
+	*c = gp_tval[t->seq];
+	return(gp_tkind[t->seq]);
+}
+
+static void
+gpstore(register int i, register tuple *p, register char *kind, register konst *val)
+{
+	/* p stores element i, so copies of i no longer hold */
+	register int j;
+
+	gp_stamp[i] = p->seq;
+	if (!gp_copied[i]) return;
+	for (j=0; j<gp_nelem; ++j) {
+		if ((kind[j] == GPCOPY) && (val[j] == i)) kind[j] = GPNAC;
+	}
+}
+
+static tuple *
+gpblock(register int b, register char *kind, register konst *val)
+{
+	/* Run block b on the facts in kind/val, which it updates;
+	   returns its SEL, or 0 if it falls through
+	*/
+	register tuple *p, *first = cfg[b].first;
+	register tuple *end = (cfg[b].last)->next;
+	register int i, k0, k1;
+	konst c0, c1;
+
+	for (p=first; p!=end; p=p->next) {
+		gp_tkind[p->seq] = GPNAC;
+		switch (p->oarg) {
+		case ADD:
+		case SUB:
+		case AND:
+		case OR:
+		case XOR:
+		case GT:
+		case GE:
+		case EQ:
+		case SSL:
+		case SSR:
+		case MUL:
+			k0 = gparg(p->targ[0], first, &c0);
+			k1 = gparg(p->targ[1], first, &c1);
+			if ((k0 == GPCONST) && (k1 == GPCONST) &&
+			    gpfold(p->oarg, c0, c1, &(gp_tval[p->seq]))) {
+				gp_tkind[p->seq] = GPCONST;
+			}
+			break;
+		case CONST:
+			gp_tkind[p->seq] = GPCONST;
+			gp_tval[p->seq] = p->carg;
+			break;
+		case LDX:
+			if ((gparg(p->targ[0], first, &c0) == GPCONST) &&
+			    ((i = gpslot(p->varg, c0, 0)) >= 0)) {
+				gp_tkind[p->seq] = GPCOPY;
+				gp_tval[p->seq] = i;
+				if (kind[i] != GPNAC) {
+					/* Constant, or what i copies */
+					gp_tkind[p->seq] = kind[i];
+					gp_tval[p->seq] = val[i];
+				}
+			}
+			break;
+		case STX:
+			if (gparg(p->targ[0], first, &c0) == GPCONST) {
+				if ((i = gpslot(p->varg, c0, 0)) >= 0) {
+					k1 = gparg(p->targ[1], first, &c1);
+					gpstore(i, p, kind, val);
+					if ((k1 == GPCOPY) && ((c1 == i) ||
+					    ((gp_stamp[c1] > (p->targ[1])->seq) &&
+					     (gp_stamp[c1] < p->seq)))) {
+						/* Itself, or stored since loaded */
+						k1 = GPNAC;
+					}
+					if (k1 == GPCOPY) gp_copied[c1] = 1;
+					kind[i] = k1;
+					val[i] = c1;
+				}
+				break;
+			}
+			/* Fall through... */
+		case KILL:
+			/* Could be any element */
+			for (i=0; i<gp_nelem; ++i) {
+				if (gp_elem[i].v == p->varg) {
+					gpstore(i, p, kind, val);
+					kind[i] = GPNAC;
+				}
+			}
+		}
+	}
+	return(cfg[b].sel);
+}
+
+static int
+gpmeet(register int b, register char *kind, register konst *val)
+{
+	/* Merge facts into block b's; 1 if they changed */
+	register char *k = &(gp_kind[b * gp_nelem]);
+	register konst *v = &(gp_val[b * gp_nelem]);
+	register int i, changed = 0;
+
+	for (i=0; i<gp_nelem; ++i) {
+		if ((kind[i] == GPTOP) || (k[i] == GPNAC)) continue;
+		if (k[i] == GPTOP) {
+			k[i] = kind[i];
+			v[i] = val[i];
+			changed = 1;
+		} else if ((kind[i] != k[i]) || (v[i] != val[i])) {
+			k[i] = GPNAC;
+			changed = 1;
+		}
+	}
+	return(changed);
+}
+
+static	int	*gp_queue, gp_qn;	/* blocks to run again */
+static	char	*gp_reached;		/* 1 if reached, 2 if also queued */
+
+static void
+gpedge(register int b, register char *kind, register konst *val)
+{
+	/* Facts flow into block b */
+	if (b < 0) return;
+	if ((gpmeet(b, kind, val) || !gp_reached[b]) && (gp_reached[b] != 2)) {
+		gp_reached[b] = 2;
+		gp_queue[gp_qn++] = b;
+	}
+}
+
+static void
+gpconsts(register int b)
+{
+	/* One tuple per constant and per load in block b, and
+	   the access chains again, as loads may have changed var
+	*/
+	register tuple *p, *q, *t;
+	register tuple *end = (cfg[b].last)->next;
+	register int i;
+
+	++blkno;
+	vncount = 0;
+	for (p=cfg[b].first; p!=end; p=p->next) {
+		switch (p->oarg) {
+		case LAB:
+		case KILL:
+		case CONST:
+			break;
+		default:
+			for (i=0; i<2; ++i) {
+				if ((t = p->targ[i]) == 0) continue;
+				if (((q = gp_fwd[t->seq]) == 0) && (t->oarg == CONST) &&
+				    ((q = vnfind(CONST, 0, 0, t->carg)) == t)) q = 0;
+				if (q) {
+					p->targ[i] = q;
+					refarg(q, 1);
+					refarg(t, -1);
+				}
+			}
+		}
+		switch (p->oarg) {
+		case CONST:
+			if (vnfind(CONST, 0, 0, p->carg) == 0) vnenter(p);
+			break;
+		case LDX:
+			if (((q = lastacc(p->varg)) != 0) && (q->oarg == LDX) &&
+			    (q->targ[0] == p->targ[0])) {
+				/* Loaded already; dead() takes this one */
+				gp_fwd[p->seq] = q;
+				p->vprev = (p->vnext = 0);
+				break;
+			}
+			/* Fall through... */
+		case STX:
+			accenter(p);
+		}
+	}
+}
+
+static void
+globalprop(void)
+{
+	register tuple *p, *s, *end;
+	register int b, i;
+	char *kind;
+	konst *val, c;
+
+	/* Blocks, and the elements worth tracking */
+	cfgbuild();
+	gp_nelem = 0;
+	for (p=code.next, i=0; p!=&code; p=p->next) ++i;
+	for (gp_hsize=1024; gp_hsize<(2*i); gp_hsize*=2) ;
+	gp_elem = ((gpelem_t *) malloc((i + 1) * sizeof(gpelem_t)));
+	gp_hash = ((int *) calloc(gp_hsize, sizeof(int)));
+	gp_tkind = ((char *) calloc(i + 1, sizeof(char)));
+	gp_tval = ((konst *) calloc(i + 1, sizeof(konst)));
+	gp_fwd = ((tuple **) calloc(i + 1, sizeof(tuple *)));
+	if (!gp_elem || !gp_hash || !gp_tkind || !gp_tval || !gp_fwd) {
+		error("out of memory for global constant propagation");
+		exit(1);
+	}
+	for (p=code.next; p!=&code; p=p->next) {
+		switch (p->oarg) {
+		case LDX:
+		case STX:
+			if ((p->targ[0])->oarg == CONST) {
+				gpslot(p->varg, (p->targ[0])->carg, 1);
+			}
+		}
+	}
+
+	/* Too big to track?  Still find what is reached */
+	if ((((double) cfgn) * gp_nelem) > GPMAXFACTS) {
+		gp_nelem = 0;
+		memset(gp_hash, 0, gp_hsize * sizeof(int));
+	}
+	gp_kind = ((char *) calloc((cfgn * gp_nelem) + 1, sizeof(char)));
+	gp_val = ((konst *) calloc((cfgn * gp_nelem) + 1, sizeof(konst)));
+	gp_queue = ((int *) malloc((cfgn + 1) * sizeof(int)));
+	gp_reached = ((char *) calloc(cfgn + 1, sizeof(char)));
+	kind = ((char *) malloc((gp_nelem + 1) * sizeof(char)));
+	val = ((konst *) malloc((gp_nelem + 1) * sizeof(konst)));
+	gp_stamp = ((int *) calloc(gp_nelem + 1, sizeof(int)));
+	gp_copied = ((char *) calloc(gp_nelem + 1, sizeof(char)));
+	if (!gp_kind || !gp_val || !gp_queue || !gp_reached || !kind || !val ||
+	    !gp_stamp || !gp_copied) {
+		error("out of memory for global constant propagation");
+		exit(1);
+	}
+
+	/* Nothing is known on the way in */
+	for (i=0; i<gp_nelem; ++i) gp_kind[i] = GPNAC;
+	gp_reached[0] = 2;
+	gp_queue[0] = 0;
+	gp_qn = 1;
+
+	/* Run blocks until their facts stop changing */
+	while (gp_qn > 0) {
+		b = gp_queue[--gp_qn];
+		gp_reached[b] = 1;
+		memcpy(kind, &(gp_kind[b * gp_nelem]), gp_nelem * sizeof(char));
+		memcpy(val, &(gp_val[b * gp_nelem]), gp_nelem * sizeof(konst));
+		if (((s = gpblock(b, kind, val)) != 0) && s->targ[0] &&
+		    (gparg(s->targ[0], cfg[b].first, &c) == GPCONST)) {
+			/* Only the way the test goes */
+			for (i=0; i<cfg[b].nsucc; ++i) {
+				if (((cfg[cfg[b].succ[i]].first)->larg[0]) ==
+				    s->larg[(c != 0) ? 0 : 1]) gpedge(cfg[b].succ[i], kind, val);
+			}
+		} else {
+			for (i=0; i<cfg[b].nsucc; ++i) gpedge(cfg[b].succ[i], kind, val);
+		}
+	}
+
+	/* Drop code nothing reaches, but keep its labels */
+	for (b=0; b<cfgn; ++b) {
+		if (gp_reached[b]) continue;
+		end = (cfg[b].last)->next;
+		for (p=cfg[b].first; p!=end; p=s) {
+			s = p->next;
+			if (p->oarg != LAB) rmtuple(p);
+		}
+	}
+
+	/* Rewrite what turned out constant */
+	for (b=0; b<cfgn; ++b) {
+		if (!gp_reached[b]) continue;
+		memcpy(kind, &(gp_kind[b * gp_nelem]), gp_nelem * sizeof(char));
+		memcpy(val, &(gp_val[b * gp_nelem]), gp_nelem * sizeof(konst));
+		s = gpblock(b, kind, val);
+		end = (cfg[b].last)->next;
+		for (p=cfg[b].first; p!=end; p=p->next) {
+			if ((p->oarg != CONST) && (gp_tkind[p->seq] == GPCONST)) {
+				/* Load or op of constants */
+				refargs(p, -1);
+				if (p->oarg == LDX) accremove(p);
+				p->oarg = CONST;
+				p->carg = gp_tval[p->seq];
+				p->targ[0] = (p->targ[1] = 0);
+				p->varg = 0;
+			} else if ((p->oarg == LDX) && (gp_tkind[p->seq] == GPCOPY) &&
+			    (gp_elem[i = gp_tval[p->seq]].v != p->varg) &&
+			    (gp_elem[i].x == (p->targ[0])->carg)) {
+				/* Load of a copy, so load the original */
+				p->varg = gp_elem[i].v;
+			}
+		}
+		if (s && s->targ[0] && ((s->targ[0])->oarg == CONST)) {
+			/* Test known, so just jump */
+			refargs(s, -1);
+			if ((s->targ[0])->carg == 0) s->larg[0] = s->larg[1];
+			s->larg[1] = s->larg[0];
+			s->targ[0] = 0;
+		}
+		gpconsts(b);
+	}
+	free(gp_kind);
+	free(gp_val);
+	free(gp_queue);
+	free(gp_reached);
+	free(kind);
+	free(val);
+	free(gp_elem);
+	free(gp_hash);
+	free(gp_tkind);
+	free(gp_tval);
+	free(gp_stamp);
+	free(gp_copied);
+	free(gp_fwd);
+	cfgfree();
+	dead();
+}
+
+tuple *
+labop(label l)
+{
+	register tuple *p;
+
+	dead();
+
+	/* New block, so forget old value numbers and constants */
+	++blkno;
+	vncount = 0;
+
+	p = mktuple();
+	p->refs = 1;
+	p->oarg = LAB;
+	p->larg[0] = l;
+
+	/* Pre-install 0 and -1 in this block */
+	zero = cop(0);
+	negone = cop(-1);
+
+	return(p);
+}
+
+tuple *
+selop(tuple *t, label l1, label l2)
+{
+	register tuple *p = mktuple();
+	p->refs = 1;
+	p->oarg = SEL;
+	p->larg[0] = l1;
+	p->larg[1] = l2;
+	p->targ[0] = t;
+
+	/* Simplifications */
+	if (l1 == l2) {
+		p->targ[0] = 0;
+	} else if (t == zero) {
+		p->targ[0] = 0;
+		p->larg[0] = l2;
+	} else if (t && (t->oarg == CONST)) {
+		p->targ[0] = 0;
+		p->larg[1] = l1;
+	} else {
+		/* Need condition evaluated */
+		refargs(p, 1);
+	}
+
+	dead();
+
+	return(p);
+}
+
+tuple *
+killop(var *v)
+{
+	register tuple *p;
+
+	/* Unref any earlier dead STX */
+	for (p=lastacc(v); p; p=p->vprev) {
+		switch (p->oarg) {
+		case STX:
+			/* This guy is no longer live */
+			p->refs = 0;
+			maybedead(p);
+			break;
+		case LDX:
+			goto killed;
+		}
+	}
+
+killed:
+	p = mktuple();
+	p->refs = 1;
+	p->oarg = KILL;
+	p->varg = v;
+	return(p);
+}
+
+static void
+cgvar(register var *v)
+{
+	/* Listing name of var v */
+	outs(cgout, v->text);
+	outc(cgout, '{');
+	outd(cgout, v->deflev);
+	outc(cgout, ',');
+	outd(cgout, v->defblk);
+	outc(cgout, '}');
+}
+
+static void
+cgargs(register char *s, register var *v, register tuple *t0, register tuple *t1)
+{
+	/* s(v, t0, t1), leaving out v and t1 if 0 */
+	outs(cgout, s);
+	outc(cgout, '(');
+	if (v) {
+		cgvar(v);
+		if (t0) outs(cgout, ", ");
+	}
+	if (t0) outd(cgout, ttoi(t0));
+	if (t1) {
+		outs(cgout, ", ");
+		outd(cgout, ttoi(t1));
+	}
+	outc(cgout, ')');
+}
+
+static void
+showop(register tuple *p)
+{
+	/* print the operation p, without its index */
+	switch (p->oarg) {
+	case ADD:
+		cgbin("add", p);
+		break;
+	case SUB:
+		cgbin("sub", p);
+		break;
+	case AND:
+		cgbin("and", p);
+		break;
+	case OR:
+		cgbin("or", p);
+		break;
 	case XOR:
 		cgbin("xor", p);
 		break;
@@ -475,59 +1331,64 @@ show(register tuple *p)
 	case SSR:
 		cgbin("ssr", p);
 		break;
+	case MUL:
+		cgbin("mul", p);
+		break;
 	case CONST:
-		printf("const(%d)", p->carg);
+		outs(cgout, "const(");
+		outd(cgout, p->carg);
+		outc(cgout, ')');
 		break;
 	case LD:
-		printf("_ld(%s{%d,%d})", (p->varg)->text,
-			(p->varg)->deflev, (p->varg)->defblk);
+		cgargs("_ld", p->varg, 0, 0);
 		break;
 	case LDX:
 		/* Convert LDX into LD? */
 		if (((p->targ[0])->oarg == CONST) &&
 		    ((p->targ[0])->carg == 0)) {
-			printf("ld(%s{%d,%d})", (p->varg)->text,
-			       (p->varg)->deflev, (p->varg)->defblk);
+			cgargs("ld", p->varg, 0, 0);
 		} else {
-			printf("ldx(%s{%d,%d}, %d)", (p->varg)->text,
-			       (p->varg)->deflev, (p->varg)->defblk,
-			       ttoi(p->targ[0]));
+			cgargs("ldx", p->varg, p->targ[0], 0);
 		}
 		break;
 	case ST:
-		printf("_st(%s{%d,%d}, %d)", (p->varg)->text,
-			(p->varg)->deflev, (p->varg)->defblk,
-			ttoi(p->targ[0]));
+		cgargs("_st", p->varg, p->targ[0], 0);
 		break;
 	case STX:
 		/* Convert STX into ST? */
 		if (((p->targ[0])->oarg == CONST) &&
 		    ((p->targ[0])->carg == 0)) {
-			printf("st(%s{%d,%d}, %d)", (p->varg)->text,
-			       (p->varg)->deflev, (p->varg)->defblk,
-			       ttoi(p->targ[1]));
+			cgargs("st", p->varg, p->targ[1], 0);
 		} else {
-			printf("stx(%s{%d,%d}, %d, %d)", (p->varg)->text,
-			       (p->varg)->deflev, (p->varg)->defblk,
-			       ttoi(p->targ[0]), ttoi(p->targ[1]));
+			cgargs("stx", p->varg, p->targ[0], p->targ[1]);
 		}
 		break;
 	case LAB:
-		printf("lab(%d)", p->larg[0]);
+		outs(cgout, "lab(");
+		outd(cgout, p->larg[0]);
+		outc(cgout, ')');
 		break;
 	case SEL:
-		printf("sel(%d, %d, %d)", ttoi(p->targ[0]),
-			p->larg[0], p->larg[1]);
+		cgsel(p);
 		break;
 	case KILL:
-		printf("kill(%s{%d,%d})", (p->varg)->text,
-			(p->varg)->deflev, (p->varg)->defblk);
+		cgargs("kill", p->varg, 0, 0);
 		break;
 	default:
-		printf("{bad opcode %d}", p->oarg);
+		outs(cgout, "{bad opcode ");
+		outd(cgout, p->oarg);
+		outc(cgout, '}');
 	}
 }
 
+static void
+show(register tuple *p)
+{
+	outd(cgout, ttoi(p));
+	outc(cgout, '\t');
+	showop(p);
+}
+
 
 void
 sequential(void)
@@ -539,7 +1400,7 @@ sequential(void)
 	while (p != &code) {
 		show(p);
 
-		printf("\n");
+		outc(cgout, '\n');
 		p = p->next;
 	}
 }
@@ -550,122 +1411,938 @@ mymax(int a, int b)
 	return((a > b) ? a : b);
 }
 
+/*	List scheduling...
+	dependences are built once per block; a tuple waits in
+	sched_wait (keyed by the earliest slot its operands allow)
+	until its slot comes, then competes in sched_ready (keyed
+	by priority, program order by default) for the 4 issue slots
+*/
+typedef struct {
+	int	*h;		/* heap of block-local tuple indices */
+	int	n;		/* how many in the heap */
+	int	*key;		/* key of each index, smallest first */
+} heap_t;
+
+/* Ties go to the earlier tuple */
+#define	heapless(Q, A, B)	(((Q)->key[A] < (Q)->key[B]) || \
+				 (((Q)->key[A] == (Q)->key[B]) && ((A) < (B))))
+
+static	__thread int	sched_max = 0;	/* size of the per-block arrays */
+static	__thread tuple	**sched_tup;	/* tuple at each block-local index */
+static	__thread int	*sched_npred;	/* unscheduled predecessors */
+static	__thread int	*sched_early;	/* earliest slot operands allow */
+static	__thread int	*sched_prio;	/* ready queue priority */
+static	__thread int	*sched_head;	/* first successor edge, or -1 */
+static	__thread int	*sched_enext;	/* next edge from the same tuple */
+static	__thread int	*sched_eto;	/* successor, times 2, plus 1 if memory order */
+static	__thread heap_t	sched_wait, sched_ready;
+static	__thread int	sched_unit[MAXUNITS][MAXUNITN];	/* slot each unit is free */
+
+static void
+defmachine(void)
+{
+	/* Without -m: 4 wide, every op takes 1 slot */
+	if (machine.width) return;
+	machinit(4);
+}
+
+static void
+heappush(register heap_t *q, register int i)
+{
+	register int j = (q->n)++;
+
+	while (j > 0) {
+		register int up = ((j - 1) / 2);
+
+		if (!heapless(q, i, q->h[up])) break;
+		q->h[j] = q->h[up];
+		j = up;
+	}
+	q->h[j] = i;
+}
+
+static int
+heappop(register heap_t *q)
+{
+	register int top = q->h[0];
+	register int i = q->h[--(q->n)];
+	register int j = 0, c;
+
+	while ((c = ((2 * j) + 1)) < q->n) {
+		if (((c + 1) < q->n) &&
+		    heapless(q, q->h[c + 1], q->h[c])) ++c;
+		if (!heapless(q, q->h[c], i)) break;
+		q->h[j] = q->h[c];
+		j = c;
+	}
+	q->h[j] = i;
+	return(top);
+}
+
+static void
+schedgrow(register int n)
+{
+	/* Make the per-block arrays hold n tuples */
+	if (n <= sched_max) return;
+	while (sched_max < n) sched_max = ((sched_max) ? (sched_max * 2) : 1024);
+	sched_tup = ((tuple **) realloc(sched_tup, sched_max * sizeof(tuple *)));
+	sched_npred = ((int *) realloc(sched_npred, sched_max * sizeof(int)));
+	sched_early = ((int *) realloc(sched_early, sched_max * sizeof(int)));
+	sched_prio = ((int *) realloc(sched_prio, sched_max * sizeof(int)));
+	sched_head = ((int *) realloc(sched_head, sched_max * sizeof(int)));
+	sched_enext = ((int *) realloc(sched_enext, 3 * sched_max * sizeof(int)));
+	sched_eto = ((int *) realloc(sched_eto, 3 * sched_max * sizeof(int)));
+	sched_wait.h = ((int *) realloc(sched_wait.h, sched_max * sizeof(int)));
+	sched_ready.h = ((int *) realloc(sched_ready.h, sched_max * sizeof(int)));
+	if ((sched_tup == 0) || (sched_npred == 0) || (sched_early == 0) ||
+	    (sched_prio == 0) || (sched_head == 0) || (sched_enext == 0) ||
+	    (sched_eto == 0) || (sched_wait.h == 0) || (sched_ready.h == 0)) {
+		error("out of memory for scheduling");
+		exit(1);
+	}
+	sched_wait.key = sched_early;
+	sched_ready.key = sched_prio;
+}
+
+static void
+schedfree(void)
+{
+	/* Give back this thread's per-block arrays */
+	free(sched_tup);
+	free(sched_npred);
+	free(sched_early);
+	free(sched_prio);
+	free(sched_head);
+	free(sched_enext);
+	free(sched_eto);
+	free(sched_wait.h);
+	free(sched_ready.h);
+	sched_tup = 0;
+	sched_npred = (sched_early = (sched_prio = (sched_head = 0)));
+	sched_enext = (sched_eto = (sched_wait.h = (sched_ready.h = 0)));
+	sched_max = 0;
+}
+
+static int
+schedtime(register tuple *q, register int mem)
+{
+	/* First slot after q for a value use or a memory reorder */
+	return((mem) ? (q->slot + 1) : (q->slot + machine.lat[q->oarg]));
+}
+
+static void
+schedarg(register int i, register tuple *q, int mem, register int base, int *nedge)
+{
+	/* Tuple i must wait for q */
+	register int k;
+
+	if (q == 0) return;
+	k = ttoi(q) - base;
+	if ((k >= 0) && (k < i) && (sched_tup[k] == q)) {
+		/* In this block: an edge, resolved as q is scheduled */
+		sched_eto[*nedge] = ((i << 1) | mem);
+		sched_enext[*nedge] = sched_head[k];
+		sched_head[k] = (*nedge)++;
+		++sched_npred[i];
+	}
+
+	/* Otherwise it was computed in an earlier block, which is all
+	   done before this one starts; not waiting on its slot there
+	   also keeps blocks independent for -j
+	*/
+}
+
 void
 schedule(register tuple *s, register tuple *e)
 {
 	/* VLIW schedule tuples s to before e...
-	   uses refs to track schedule level
+	   slot records where each tuple landed
 	*/
-	register tuple *p, *q;
+	register tuple *p;
+	register int i, j, k, u;
 	register int more = 0;
 	register int slot = 0;
+	int n, base, nedge = 0;
+
+	/* Every unit is idle at the top of the block */
+	defmachine();
+	for (u=0; u<machine.nunits; ++u) {
+		for (k=0; k<machine.unit[u].count; ++k) sched_unit[u][k] = 0;
+	}
+
+	/* Number the block */
+	base = ttoi(s);
+	n = ttoi(e) - base;
+	schedgrow(n);
 
-	/* Mark what's ready */
+	/* Dependence edges: operands, and earlier LDX/STX of the same var */
 #define	NOSLOT	1000000
-	for (p=s; p!=e; p=p->next) {
+	for (p=s, i=0; p!=e; p=p->next, ++i) {
+		sched_tup[i] = p;
+		sched_npred[i] = 0;
+		sched_early[i] = 0;
+		sched_prio[i] = i;
+		sched_head[i] = -1;
 		p->slot = NOSLOT;
+	}
+	sched_wait.n = 0;
+	sched_ready.n = 0;
+	for (p=s, i=0; p!=e; p=p->next, ++i) {
+		switch (p->oarg) {
+		case ADD:
+		case SUB:
+		case AND:
+		case OR:
+		case XOR:
+		case GT:
+		case GE:
+		case EQ:
+		case SSL:
+		case SSR:
+		case MUL:
+			schedarg(i, p->targ[0], 0, base, &nedge);
+			schedarg(i, p->targ[1], 0, base, &nedge);
+			break;
+		case STX:
+			schedarg(i, p->targ[1], 0, base, &nedge);
+			/* Fall through */
+		case LDX:
+			schedarg(i, p->targ[0], 0, base, &nedge);
+			schedarg(i, p->vprev, 1, base, &nedge);
+			break;
+		case CONST:
+			break;
+		case KILL:
+			/* Nothing to execute */
+			sched_npred[i] = -1;
+			continue;
+		default:
+			outf(cgout, "Eek! %d\n", ttoi(p));
+			sched_npred[i] = -1;
+			continue;
+		}
 		++more;
 	}
 
+	/* Rank by latency-weighted height to the end of the block? */
+	if (critpath) {
+		for (i=n-1; i>=0; --i) {
+			register int h, lat;
+
+			p = sched_tup[i];
+			lat = schedtime(p, 0) - p->slot;
+			h = lat;
+			for (k=sched_head[i]; k>=0; k=sched_enext[k]) {
+				register int t = (((sched_eto[k] & 1) ? 1 : lat) +
+						  sched_prio[sched_eto[k] >> 1]);
+
+				if (t > h) h = t;
+			}
+			sched_prio[i] = h;
+		}
+		for (i=0; i<n; ++i) sched_prio[i] = -sched_prio[i];
+	}
+	for (i=0; i<n; ++i) {
+		if (sched_npred[i] == 0) heappush(&sched_wait, i);
+	}
+
 	while (more) {
 		register int wide = 0;
 
-		printf("%d:\t", slot);
-		for (p=s; ((wide<4) && (p!=e)); p=p->next)
-		if (p->slot == NOSLOT) {
-
-			switch (p->oarg) {
-			case ADD:
-			case SUB:
-			case AND:
-			case OR:
-			case XOR:
-			case GT:
-			case GE:
-			case EQ:
-			case SSL:
-			case SSR:
-				if (((p->targ[0])->slot < slot) && ((p->targ[1])->slot < slot)) {
-					p->slot = slot;
-					--more;
-					show(p);
-					if (++wide < 4) printf("\t");
-				}
-				break;
-			case STX:
-			case LDX:
-				/* Earlier LD/ST still to schedule */
-				for (q=s; q!=p; q=q->next) {
-					if (q->slot >= slot)
-					switch (q->oarg) {
-					case LDX:
-					case STX:
-						if (q->varg == p->varg) goto nope;
-					}
+		/* Everything whose operands are done by now is ready */
+		while ((sched_wait.n > 0) &&
+		       (sched_early[sched_wait.h[0]] <= slot)) {
+			heappush(&sched_ready, heappop(&sched_wait));
+		}
+		if ((sched_wait.n == 0) && (sched_ready.n == 0)) {
+			error("unschedulable tuples");
+			break;
+		}
+
+		outd(cgout, slot);
+		outs(cgout, ":\t");
+		while ((wide < machine.width) && (sched_ready.n > 0)) {
+			i = heappop(&sched_ready);
+			p = sched_tup[i];
+			/* Needs a functional unit?  Take the first one free */
+			if ((u = machine.use[p->oarg]) >= 0) {
+				register int *f = sched_unit[u];
+
+				for (j=0, k=1; k<machine.unit[u].count; ++k) {
+					if (f[k] < f[j]) j = k;
 				}
-				if (((p->targ[0])->slot < slot) &&
-				    ((p->oarg == LDX) || ((p->targ[1])->slot < slot))) {
-					p->slot = slot;
-					--more;
-					show(p);
-					if (++wide < 4) printf("\t");
+				if (f[j] > slot) {
+					sched_early[i] = f[j];
+					heappush(&sched_wait, i);
+					continue;
 				}
-				break;
-			case CONST:
-				p->slot = slot;
-				--more;
-				show(p);
-				if (++wide < 4) printf("\t");
-				break;
-			default:
-				printf("Eek! %d\n", ttoi(p));
+				f[j] = slot + machine.unit[u].busy;
+			}
+			p->slot = slot;
+			--more;
+			show(p);
+			if (++wide < machine.width) outc(cgout, '\t');
+
+			/* Successors can go once their last operand is done */
+			for (k=sched_head[i]; k>=0; k=sched_enext[k]) {
+				register int j = (sched_eto[k] >> 1);
+				register int t = schedtime(p, (sched_eto[k] & 1));
+
+				if (t > sched_early[j]) sched_early[j] = t;
+				if (--sched_npred[j] == 0) heappush(&sched_wait, j);
 			}
-
-nope:			;
 		}
 
-		printf("\n");
+		outc(cgout, '\n');
 		++slot;
 	}
 }
 
 		
 
-void
-codegen(void)
+/*	Modulo scheduling of while loops (-l)...
+	stat() builds a while as a header block ending in
+	sel(c, body, exit) and a body block ending in
+	sel(-1, header, header).  One iteration is the header then
+	the body, and a new one starts every ii slots.  Stores wait
+	until the stage after the one in which c is known, so the
+	loop can leave at the end of any stage by dropping the
+	younger iterations and draining the older ones.
+*/
+#define	MAXMOD	1024		/* biggest loop body we try */
+#define	MODDATA	0		/* value: lat slots later */
+#define	MODMEM	1		/* same var memory order */
+#define	MODCTL	2		/* store after its exit test */
+#define	MODREG	3		/* value used before it is recomputed */
+#define	MODBUDGET	6	/* placements per op before ii grows */
+
+typedef struct {
+	int	from, to;	/* op numbers */
+	int	lat;		/* to at least lat slots after from ... */
+	int	dist;		/* ... in the iteration dist later */
+	int	kind;
+} modedge_t;
+
+static	tuple	*mod_tup[MAXMOD];	/* ops of one iteration */
+static	int	mod_num[MAXMOD + 4];	/* op number by seq - mod_base */
+static	int	mod_time[MAXMOD];	/* slot in one iteration, -1 if none */
+static	int	mod_prev[MAXMOD];	/* last slot tried, -1 if none */
+static	int	mod_height[MAXMOD];	/* priority */
+static	modedge_t	mod_edge[7 * MAXMOD];
+static	int	mod_n, mod_nedge, mod_base, mod_cond;
+static	int	*mod_rowuse;		/* issue slots used in each row */
+static	int	*mod_unituse[MAXUNITS];	/* units busy in each row */
+
+static int
+modop(register tuple *q)
 {
-	/* print listing of generated code */
-	register tuple *p, *start;
+	/* Op number of q, or -1 if not in the loop */
+	register int k;
+
+	if (q == 0) return(-1);
+	k = ttoi(q) - mod_base;
+	if ((k < 0) || (k >= (MAXMOD + 4))) return(-1);
+	k = mod_num[k];
+	return(((k >= 0) && (k < mod_n) && (mod_tup[k] == q)) ? k : -1);
+}
 
-	dead();
+static void
+modadd(int from, int to, int lat, int dist, int kind)
+{
+	register modedge_t *e = &(mod_edge[mod_nedge++]);
 
-	sequential();
+	e->from = from;
+	e->to = to;
+	e->lat = lat;
+	e->dist = dist;
+	e->kind = kind;
+}
 
-	printf("\n\n");
+static void
+moddata(register int to, register tuple *q)
+{
+	/* to uses the value of q; values from outside are invariant.
+	   There is one register per value, so the next iteration's
+	   q must not issue before to reads this one.
+	*/
+	register int from = modop(q);
 
-	/* Schedule block by block */
-	start = (p = code.next);
-	while (p != &code) {
+	if (from >= 0) {
+		modadd(from, to, machine.lat[q->oarg], 0, MODDATA);
+		modadd(to, from, 0, 1, MODREG);
+	}
+}
+
+static int
+modloop(register int b)
+{
+	/* Are blocks b and b+1 a while loop we can pipeline?
+	   If so, sets up the ops and edges
+	*/
+	register tuple *p, *h, *hs, *bs;
+	register int i, j;
+	int mem[MAXMOD], nmem = 0;
+
+	/* Header tests, body follows it and jumps back */
+	if (((h = cfg[b].first)->oarg != LAB) || ((hs = cfg[b].sel) == 0) ||
+	    (hs->targ[0] == 0) || ((b + 1) >= cfgn)) return(0);
+	for (p=h; p!=hs; p=p->next) {
+		if (p->oarg == STX) return(0);
+	}
+	if (((cfg[b + 1].first)->oarg != LAB) ||
+	    ((cfg[b + 1].first)->larg[0] != hs->larg[0]) ||
+	    ((bs = cfg[b + 1].sel) == 0) || (bs->targ[0] != 0) ||
+	    (cfg[b + 1].nsucc != 1) || (cfg[b + 1].succ[0] != b) ||
+	    !cfgdom(b, b + 1)) return(0);
+	mod_base = ttoi(h->next);
+	if ((ttoi(bs) - mod_base) > MAXMOD) return(0);
+
+	/* Number the ops: header, then body */
+	mod_n = 0;
+	for (p=h->next; p!=bs; p=p->next) {
+		mod_num[ttoi(p) - mod_base] = -1;
 		switch (p->oarg) {
 		case LAB:
-			if (p != start) schedule(start, p);
-			printf("%d\t", ttoi(p));
-			printf("lab(%d)\n", p->larg[0]);
-			start = p->next;
-			break;
 		case SEL:
-			if (p != start) schedule(start, p);
-			printf("%d\t", ttoi(p));
-			printf("sel(%d, %d, %d)\n", ttoi(p->targ[0]),
-				p->larg[0], p->larg[1]);
-			start = p->next;
-			break;
 		case KILL:
-			/* Ignore kills for now */
 			break;
+		default:
+			mod_num[ttoi(p) - mod_base] = mod_n;
+			mod_tup[mod_n++] = p;
 		}
+	}
+	if ((mod_n == 0) || ((mod_cond = modop(hs->targ[0])) < 0)) return(0);
 
-		p = p->next;
+	/* Value, memory and control dependences */
+	mod_nedge = 0;
+	for (i=0; i<mod_n; ++i) {
+		p = mod_tup[i];
+		switch (p->oarg) {
+		case ADD:
+		case SUB:
+		case AND:
+		case OR:
+		case XOR:
+		case GT:
+		case GE:
+		case EQ:
+		case SSL:
+		case SSR:
+		case MUL:
+			moddata(i, p->targ[0]);
+			moddata(i, p->targ[1]);
+			break;
+		case STX:
+			moddata(i, p->targ[1]);
+			modadd(mod_cond, i, machine.lat[(mod_tup[mod_cond])->oarg], 0, MODCTL);
+			/* Fall through */
+		case LDX:
+			moddata(i, p->targ[0]);
+
+			/* After the last access of the same var; the
+			   first one also waits for the previous
+			   iteration's last one
+			*/
+			for (j=nmem-1; j>=0; --j) {
+				if ((mod_tup[mem[j]])->varg == p->varg) break;
+			}
+			if (j >= 0) {
+				modadd(mem[j], i, 1, 0, MODMEM);
+			} else {
+				for (j=mod_n-1; j>=i; --j) {
+					switch ((mod_tup[j])->oarg) {
+					case LDX:
+					case STX:
+						if ((mod_tup[j])->varg == p->varg) goto last;
+					}
+				}
+last:
+				modadd(j, i, 1, 1, MODMEM);
+			}
+			mem[nmem++] = i;
+		}
+	}
+	return(1);
+}
+
+static int
+modreq(register modedge_t *e, register int ii)
+{
+	/* Earliest slot e->to may take, given where e->from is */
+	register int t = mod_time[e->from];
+
+	if (e->kind == MODCTL) {
+		/* The stage after the one in which from is known */
+		return(ii * (((t + e->lat - 1) / ii) + 1));
+	}
+	return(t + e->lat - (ii * e->dist));
+}
+
+static int
+modcycle(register int ii)
+{
+	/* Is there a dependence cycle ii is too short for? */
+	register int i, k, changed;
+
+	for (i=0; i<mod_n; ++i) mod_height[i] = 0;
+	for (k=0; k<=mod_n; ++k) {
+		changed = 0;
+		for (i=0; i<mod_nedge; ++i) {
+			register modedge_t *e = &(mod_edge[i]);
+			register int t = mod_height[e->from] + e->lat - (ii * e->dist);
+
+			if (t > mod_height[e->to]) {
+				mod_height[e->to] = t;
+				changed = 1;
+			}
+		}
+		if (!changed) return(0);
+	}
+	return(1);
+}
+
+static void
+modtake(register int i, register int t, register int ii, register int d)
+{
+	/* Add (d=1) or remove (d=-1) op i's resources at slot t */
+	register int k, u = machine.use[(mod_tup[i])->oarg];
+
+	mod_time[i] = ((d > 0) ? t : -1);
+	mod_rowuse[t % ii] += d;
+	if (u >= 0) {
+		for (k=0; k<machine.unit[u].busy; ++k) {
+			mod_unituse[u][(t + k) % ii] += d;
+		}
+	}
+}
+
+static int
+modfits(register int i, register int t, register int ii)
+{
+	/* Could op i go in slot t without overcommitting a row? */
+	register int k, ok, u = machine.use[(mod_tup[i])->oarg];
+
+	modtake(i, t, ii, 1);
+	ok = (mod_rowuse[t % ii] <= machine.width);
+	if (u >= 0) {
+		for (k=0; k<machine.unit[u].busy; ++k) {
+			if (mod_unituse[u][(t + k) % ii] > machine.unit[u].count) ok = 0;
+		}
 	}
+	modtake(i, t, ii, -1);
+	return(ok);
+}
+
+static int
+modclash(register int j, register int i, register int t, register int ii)
+{
+	/* Does scheduled op j hold something op i needs at slot t? */
+	register int a, b, u = machine.use[(mod_tup[i])->oarg];
+
+	if ((mod_rowuse[t % ii] >= machine.width) &&
+	    ((mod_time[j] % ii) == (t % ii))) return(1);
+	if ((u < 0) || (machine.use[(mod_tup[j])->oarg] != u)) return(0);
+	for (a=0; a<machine.unit[u].busy; ++a) {
+		for (b=0; b<machine.unit[u].busy; ++b) {
+			if (((t + a) % ii) == ((mod_time[j] + b) % ii)) return(1);
+		}
+	}
+	return(0);
+}
+
+static int
+modtry(register int ii)
+{
+	/* Iterative modulo scheduling at this ii; 1 if it worked */
+	register int i, j, k, t;
+	int left = mod_n, budget = MODBUDGET * mod_n;
+
+	for (k=0; k<ii; ++k) mod_rowuse[k] = 0;
+	for (j=0; j<machine.nunits; ++j) {
+		for (k=0; k<ii; ++k) mod_unituse[j][k] = 0;
+	}
+	for (i=0; i<mod_n; ++i) {
+		mod_time[i] = -1;
+		mod_prev[i] = -1;
+	}
+
+	/* Height to the end of the iteration */
+	for (i=0; i<mod_n; ++i) mod_height[i] = 0;
+	for (k=0; k<mod_n; ++k) {
+		register int changed = 0;
+
+		for (j=0; j<mod_nedge; ++j) {
+			register modedge_t *e = &(mod_edge[j]);
+
+			t = mod_height[e->to] + e->lat - (ii * e->dist);
+			if (t > mod_height[e->from]) {
+				mod_height[e->from] = t;
+				changed = 1;
+			}
+		}
+		if (!changed) break;
+	}
+
+	while (left > 0) {
+		register int estart = 0;
+
+		if (--budget < 0) return(0);
+
+		/* Tallest unscheduled op */
+		for (i=-1, j=0; j<mod_n; ++j) {
+			if ((mod_time[j] < 0) &&
+			    ((i < 0) || (mod_height[j] > mod_height[i]))) i = j;
+		}
+
+		/* Earliest slot its scheduled predecessors allow */
+		for (j=0; j<mod_nedge; ++j) {
+			register modedge_t *e = &(mod_edge[j]);
+
+			if ((e->to == i) && (e->from != i) && (mod_time[e->from] >= 0)) {
+				t = modreq(e, ii);
+				if (t > estart) estart = t;
+			}
+		}
+
+		/* First slot with room, else force one and evict */
+		for (t=estart; t<estart+ii; ++t) {
+			if (modfits(i, t, ii)) break;
+		}
+		if (t >= estart+ii) {
+			t = (((mod_prev[i] < 0) || (estart > mod_prev[i])) ?
+			     estart : (mod_prev[i] + 1));
+			while (!modfits(i, t, ii)) {
+				for (j=0; j<mod_n; ++j) {
+					if ((j != i) && (mod_time[j] >= 0) &&
+					    modclash(j, i, t, ii)) break;
+				}
+				if (j >= mod_n) return(0);
+				modtake(j, mod_time[j], ii, -1);
+				++left;
+			}
+		}
+		modtake(i, t, ii, 1);
+		mod_prev[i] = t;
+		--left;
+
+		/* Successors it no longer leaves room for */
+		for (j=0; j<mod_nedge; ++j) {
+			register modedge_t *e = &(mod_edge[j]);
+
+			if ((e->from == i) && (e->to != i) &&
+			    (mod_time[e->to] >= 0) &&
+			    (mod_time[e->to] < modreq(e, ii))) {
+				modtake(e->to, mod_time[e->to], ii, -1);
+				++left;
+			}
+		}
+	}
+	return(1);
+}
+
+static int
+modcheck(register int ii)
+{
+	/* Recheck a schedule from mod_time alone: every dependence
+	   kept, no row or unit overcommitted; 0 rejects it
+	*/
+	register int i, k, t, u;
+
+	for (i=0; i<mod_n; ++i) {
+		if (mod_time[i] < 0) return(0);
+	}
+	for (i=0; i<mod_nedge; ++i) {
+		if (mod_time[mod_edge[i].to] < modreq(&(mod_edge[i]), ii)) return(0);
+	}
+	for (k=0; k<ii; ++k) mod_rowuse[k] = 0;
+	for (u=0; u<machine.nunits; ++u) {
+		for (k=0; k<ii; ++k) mod_unituse[u][k] = 0;
+	}
+	for (i=0; i<mod_n; ++i) {
+		t = mod_time[i];
+		if (++mod_rowuse[t % ii] > machine.width) return(0);
+		if ((u = machine.use[(mod_tup[i])->oarg]) >= 0) {
+			for (k=0; k<machine.unit[u].busy; ++k) {
+				if (++mod_unituse[u][(t + k) % ii] > machine.unit[u].count) return(0);
+			}
+		}
+	}
+	return(1);
+}
+
+static void
+modrow(int lo, int hi, int row, int ii, int n)
+{
+	/* Print listing row n: row's ops in stages lo to hi */
+	register int i, t, wide = 0;
+
+	outd(cgout, n);
+	outs(cgout, ":\t");
+	for (i=0; i<mod_n; ++i) {
+		t = mod_time[i];
+		if (((t % ii) == row) && ((t / ii) >= lo) && ((t / ii) <= hi)) {
+			outd(cgout, ttoi(mod_tup[i]));
+			outc(cgout, '.');
+			outd(cgout, (t / ii));
+			outc(cgout, '\t');
+			showop(mod_tup[i]);
+			if (++wide < machine.width) outc(cgout, '\t');
+		}
+	}
+	outc(cgout, '\n');
+}
+
+static void
+modleave(int x, int sc, int stages, label out)
+{
+	/* Exit test at the end of prologue round (or kernel) x */
+	outf(cgout, "// leave for %d", out);
+	if ((x > sc) && (sc < (stages - 2))) outf(cgout, " via epilogue %d", x);
+	outf(cgout, " unless %d.%d", ttoi(mod_tup[mod_cond]), sc);
+	if (x >= (stages - 1)) outs(cgout, ", else repeat kernel");
+	outc(cgout, '\n');
+}
+
+static int
+pipeloop(register int b)
+{
+	/* Print a modulo schedule for the loop headed by block b, if it
+	   is one; returns 1 if that covered blocks b and b+1, or 0 to
+	   schedule them normally
+	*/
+	register tuple *bs, *hs;
+	register int i, j, k, ii, stages, sc, row, n;
+	int resmii, recmii, lo, hi, len = 0;
+
+	defmachine();
+	if (!modloop(b)) return(0);
+	hs = cfg[b].sel;
+	bs = cfg[b + 1].sel;
+
+	/* Lower bounds: resources, then recurrences */
+	resmii = ((mod_n + machine.width - 1) / machine.width);
+	for (k=0; k<machine.nunits; ++k) {
+		for (i=0, j=0; i<mod_n; ++i) {
+			if (machine.use[(mod_tup[i])->oarg] == k) j += machine.unit[k].busy;
+		}
+		j = ((j + machine.unit[k].count - 1) / machine.unit[k].count);
+		if (j > resmii) resmii = j;
+	}
+	for (i=0; i<mod_n; ++i) len += machine.lat[(mod_tup[i])->oarg];
+	len += mod_n;
+	if (len < resmii) len = resmii;
+	lo = 1;
+	hi = len;
+	while (lo < hi) {
+		ii = ((lo + hi) / 2);
+		if (modcycle(ii)) lo = ii + 1; else hi = ii;
+	}
+	recmii = lo;
+
+	/* Try ii upward until iterative modulo scheduling succeeds */
+	mod_rowuse = ((int *) malloc(len * 2 * sizeof(int)));
+	for (k=0; k<machine.nunits; ++k) {
+		mod_unituse[k] = ((int *) malloc(len * 2 * sizeof(int)));
+		if (mod_unituse[k] == 0) mod_rowuse = 0;
+	}
+	if (mod_rowuse == 0) {
+		error("out of memory for modulo scheduling");
+		exit(1);
+	}
+	for (ii=((recmii > resmii) ? recmii : resmii); ii<(len * 2); ++ii) {
+		if (modtry(ii) && modcheck(ii)) break;
+	}
+	if (ii >= (len * 2)) {
+		/* Give up; schedule the blocks as usual */
+		free(mod_rowuse);
+		for (k=0; k<machine.nunits; ++k) free(mod_unituse[k]);
+		return(0);
+	}
+
+	/* An iteration starts in stage 0, not some later one */
+	for (i=1, k=mod_time[0]; i<mod_n; ++i) {
+		if (mod_time[i] < k) k = mod_time[i];
+	}
+	for (i=0, k=(ii * (k / ii)); i<mod_n; ++i) mod_time[i] -= k;
+
+	/* Stages, and the stage in which the exit test is known */
+	for (i=0, stages=0, len=0; i<mod_n; ++i) {
+		if ((mod_time[i] / ii) >= stages) stages = (mod_time[i] / ii) + 1;
+		k = mod_time[i] + machine.lat[(mod_tup[i])->oarg];
+		if (k > len) len = k;
+	}
+	i = mod_time[mod_cond] + machine.lat[(mod_tup[mod_cond])->oarg] - 1;
+	sc = (i / ii);
+
+	outf(cgout, "// pipelined: ii %d (resources %d, recurrences %d), "
+	       "%d stages, iteration %d slots\n",
+	       ii, resmii, recmii,
+	       stages, len);
+
+	/* Prologue round r starts iteration r */
+	for (k=0, n=0; k<stages-1; ++k) {
+		outf(cgout, "// prologue %d\n", k);
+		for (row=0; row<ii; ++row) modrow(0, k, row, ii, n++);
+		if (k >= sc) modleave(k, sc, stages, hs->larg[1]);
+	}
+
+	outs(cgout, "// kernel\n");
+	for (row=0; row<ii; ++row) modrow(0, stages-1, row, ii, n++);
+	modleave(stages-1, sc, stages, hs->larg[1]);
+
+	/* Epilogue x drains iterations older than the one leaving */
+	for (k=sc+1; k<stages; ++k) {
+		if (sc >= (stages - 2)) break;
+		outf(cgout, "// epilogue %d\n", k);
+		for (j=1; j<=(stages-2-sc); ++j) {
+			lo = sc + 1 + j;
+			hi = (((k + j) < stages) ? (k + j) : (stages - 1));
+			for (row=0; row<ii; ++row) modrow(lo, hi, row, ii, n++);
+		}
+	}
+
+	free(mod_rowuse);
+	for (k=0; k<machine.nunits; ++k) free(mod_unituse[k]);
+
+	/* The loop's own branches and label */
+	show(hs);
+	outc(cgout, '\n');
+	show(hs->next);
+	outc(cgout, '\n');
+	show(bs);
+	outc(cgout, '\n');
+	return(1);
+}
+
+/*	The -p listing...
+	blocks are scheduled independently, so with -j they are
+	handed to a pool of threads.  Each thread lists into its own
+	buffer, noting where each block's text lands there, and the
+	blocks are printed from those in program order.  Pipelined
+	loops share the modulo scheduler's state, so they and the
+	labels are listed into one more buffer before the pool starts.
+*/
+typedef struct {
+	int	at, len;	/* where its text is ... */
+	int	who;		/* ... in which buffer */
+} cgpart_t;
+
+static	out_t	*cg_str;	/* 0 for labels, 1+w for thread w */
+static	cgpart_t	*cg_lab, *cg_sched;	/* each block's two parts */
+static	char	*cg_done;	/* listed with the loop before the pool */
+
+static int
+cglab(register int b)
+{
+	/* List block b's LAB, if any, and pipeline the loop it heads;
+	   returns 1 if that listed blocks b and b+1
+	*/
+	register tuple *p = cfg[b].first;
+
+	if (p->oarg != LAB) return(0);
+	show(p);
+	outc(cgout, '\n');
+	return(pipeline && pipeloop(b));
+}
+
+static void
+cgblock(register int b)
+{
+	/* Schedule and list block b, less its LAB */
+	register tuple *p, *start = cfg[b].first, *end;
+
+	if (start->oarg == LAB) start = start->next;
+	end = ((cfg[b].sel) ? cfg[b].sel : (cfg[b].last)->next);
+	if (start != end) schedule(start, end);
+	if ((p = cfg[b].sel) != 0) {
+		show(p);
+		outc(cgout, '\n');
+	}
+}
+
+static void
+cgjob(register int b, register int w)
+{
+	/* Pool job: block b, on thread w */
+	register cgpart_t *c = &(cg_sched[b]);
+
+	if (cg_done[b]) return;
+	cgout = &(cg_str[++w]);
+	c->who = w;
+	c->at = cgout->n;
+	cgblock(b);
+	c->len = cgout->n - c->at;
+}
+
+static void
+cgput(register cgpart_t *c)
+{
+	/* Print a block's part */
+	if (c->len > 0) outw(&out, cg_str[c->who].buf + c->at, c->len);
+}
+
+static void
+cglist(void)
+{
+	/* -p listing of every block */
+	register int b;
+	int *cost;
+
+	if (jobs <= 1) {
+		for (b=0; b<cfgn; ++b) {
+			if (cglab(b)) ++b; else cgblock(b);
+		}
+		return;
+	}
+
+	cg_str = ((out_t *) calloc(jobs + 1, sizeof(out_t)));
+	cg_lab = ((cgpart_t *) calloc(cfgn + 1, sizeof(cgpart_t)));
+	cg_sched = ((cgpart_t *) calloc(cfgn + 1, sizeof(cgpart_t)));
+	cg_done = ((char *) calloc(cfgn + 1, sizeof(char)));
+	cost = ((int *) malloc((cfgn + 1) * sizeof(int)));
+	if (!cg_str || !cg_lab || !cg_sched || !cg_done || !cost) {
+		error("out of memory for parallel scheduling");
+		exit(1);
+	}
+	defmachine();
+	for (b=0; b<=jobs; ++b) outinit(&(cg_str[b]), 0);
+	cgout = &(cg_str[0]);
+	for (b=0; b<cfgn; ++b) {
+		cg_lab[b].at = cgout->n;
+		if (!cg_done[b] && cglab(b)) cg_done[b] = (cg_done[b + 1] = 1);
+		cg_lab[b].len = cgout->n - cg_lab[b].at;
+		cost[b] = ((cg_done[b]) ? 0 : ((cfg[b].last)->seq - (cfg[b].first)->seq + 1));
+	}
+	workpool(cfgn, cost, cgjob, schedfree);
+
+	cgout = &out;
+	for (b=0; b<cfgn; ++b) {
+		cgput(&(cg_lab[b]));
+		cgput(&(cg_sched[b]));
+	}
+	for (b=0; b<=jobs; ++b) outfree(&(cg_str[b]));
+	free(cg_str);
+	free(cg_lab);
+	free(cg_sched);
+	free(cg_done);
+	free(cost);
+}
+
+void
+codegen(void)
+{
+	/* print listing of generated code */
+	dead();
+	globalprop();
+	cfgbuild();
+	cgout = &out;
+
+	sequential();
+
+	outs(&out, "\n\n");
+
+	/* Schedule block by block */
+	cglist();
+	cfgfree();
 }
 
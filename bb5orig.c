@@ -13,20 +13,26 @@ static	tuple	code = {
 
 static	tuple	*zero, *negone;
 
-static int
-ttoi(register tuple *t)
+static	int	renum = 0;	/* seq stale since a rmtuple()? */
+
+static void
+renumber(void)
 {
-	/* tuple pointer to int position */
+	/* make seq the int position of every tuple again */
 	register int i = 0;
-	register tuple *p = code.next;
+	register tuple *p;
 
-	while (p != &code) {
-		if (p == t) return(i);
-		++i;
-		p = p->next;
-	}
+	for (p=code.next; p!=&code; p=p->next) p->seq = i++;
+	renum = 0;
+}
 
-	return(-1);
+static int
+ttoi(register tuple *t)
+{
+	/* tuple pointer to int position */
+	if (t == 0) return(-1);
+	if (renum) renumber();
+	return(t->seq);
 }
 
 static void
@@ -43,6 +49,9 @@ mktuple(void)
 
 	p->next = &code;
 	(p->prev = code.prev)->next = p;
+
+	/* Position follows the old tail; still in order even if stale */
+	p->seq = ((p->prev == &code) ? 0 : ((p->prev)->seq + 1));
 	return(code.prev = p);
 }
 
@@ -54,6 +63,7 @@ rmtuple(register tuple *p)
 	(p->prev)->next = p->next;
 	(p->next)->prev = p->prev;
 	free((char *) p);
+	renum = 1;
 }
 
 tuple *
@@ -87,7 +97,7 @@ binop(opcode o, tuple *t1, tuple *t2)
 		/* Forces CONST 0 or -1 into second position so it's the
 		   same place as for SUB
 		*/
-		if (ttoi(t1) < ttoi(t2)) {
+		if (t1->seq < t2->seq) {
 			tuple *t = t1;
 			t1 = t2;
 			t2 = t;
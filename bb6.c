@@ -6,13 +6,96 @@
 */
 
 #include "bb.h"
+#include "bbnet.h"
 
 #define NANDLOGIC 1
 
-gate_t	gate[MAXGATES];
+/* Bit i of constant v, sign extended past the top of a konst */
+#define	KBIT(V, I)	((((I) < 31) ? ((V) >> (I)) : ((V) >> 31)) & 1)
+
+gate_t	*gate = 0;	/* gate pool, grown on demand */
+static	int	gatesmax = 0;	/* allocated size of gate pool */
 int	gatesp = 0;
 int	gatesneed = 0;
-bus_t	bus_zero = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+/*	Structural hash of the gate pool...
+	open-addressed table of (gate number + 1), so 0 means empty
+*/
+static	int	*gatehash = 0;
+static	int	gatehsize = 0;	/* table size, always a power of 2 */
+
+static unsigned int
+hashgate(register int arg0,
+register int arg1,
+register opcode op)
+{
+	/* Mix (op, arg0, arg1) into a table index */
+	register unsigned int h;
+
+	h = (((unsigned int) arg0) * 0x9e3779b1U);
+	h ^= (((unsigned int) arg1) * 0x85ebca77U);
+	h ^= (((unsigned int) op) * 0xc2b2ae3dU);
+	h ^= (h >> 15);
+	return(h & (gatehsize - 1));
+}
+
+static void
+rehashgates(void)
+{
+	/* Grow the hash table and reinsert every gate */
+	register int i;
+	register unsigned int h;
+
+	free(gatehash);
+	gatehsize = ((gatehsize) ? (gatehsize * 2) : 4096);
+	gatehash = ((int *) calloc(gatehsize, sizeof(int)));
+	if (gatehash == 0) {
+		fprintf(stderr, "out of memory for gate hash table\n");
+		exit(1);
+	}
+
+	forgates (i) {
+		h = hashgate(gate[i].arg0, gate[i].arg1, gate[i].op);
+		while (gatehash[h]) h = ((h + 1) & (gatehsize - 1));
+		gatehash[h] = i + 1;
+	}
+}
+
+static void
+growgates(void)
+{
+	/* Double the gate pool; gate numbers must stay below VARBIAS */
+	register int n = ((gatesmax) ? (gatesmax * 2) : GATECHUNK);
+
+	if (n > VARBIAS) n = VARBIAS;
+	if (gatesp >= n) {
+		fprintf(stderr, "too many gates (limit %d)\n", VARBIAS);
+		exit(1);
+	}
+	gate = ((gate_t *) realloc(gate, n * sizeof(gate_t)));
+	if (gate == 0) {
+		fprintf(stderr, "out of memory for %d gates\n", n);
+		exit(1);
+	}
+	gatesmax = n;
+}
+
+static void
+initgates(void)
+{
+	/* Force constants 0 and 1 to exist */
+	growgates();
+	gate[0].op = '0';
+	gate[0].arg0 = 0;
+	gate[0].arg1 = 0;
+	gate[0].needed = 1;
+	gate[1].op = '1';
+	gate[1].arg0 = 1;
+	gate[1].arg1 = 1;
+	gate[1].needed = 1;
+	gatesp = 2;
+	rehashgates();
+}
 
 int
 mkgate(register int arg0,
@@ -21,20 +104,10 @@ register opcode op)
 {
 	/* Make new gate or find old one */
 	register int i;
+	register unsigned int h;
 
 	/* Force initialization */
-	if (gatesp == 0) {
-		/* Force constants 0 and 1 to exist */
-		gate[0].op = '0';
-		gate[0].arg0 = 0;
-		gate[0].arg1 = 0;
-		gate[0].needed = 1;
-		gate[1].op = '1';
-		gate[1].arg0 = 1;
-		gate[1].arg1 = 1;
-		gate[1].needed = 1;
-		gatesp = 2;
-	}
+	if (gatesp == 0) initgates();
 
 	/* Normalize operand order */
 	if (arg0 > arg1) {
@@ -44,20 +117,28 @@ register opcode op)
 	}
 
 	/* Find old one */
-	for (i=0; i<gatesp; ++i) {
+	h = hashgate(arg0, arg1, op);
+	while ((i = gatehash[h]) != 0) {
+		--i;
 		if ((gate[i].op == op) &&
 		    (gate[i].arg0 == arg0) &&
 		    (gate[i].arg1 == arg1)) {
 			return(i);
 		}
+		h = ((h + 1) & (gatehsize - 1));
 	}
 
 	/* Make new one */
-	++gatesp;
+	if (gatesp >= gatesmax) growgates();
+	i = gatesp++;
 	gate[i].op = op;
 	gate[i].arg0 = arg0;
 	gate[i].arg1 = arg1;
 	gate[i].needed = 0;
+	gatehash[h] = i + 1;
+
+	/* Keep the table at most half full */
+	if ((gatesp * 2) > gatehsize) rehashgates();
 	return(i);
 }
 
@@ -159,121 +240,239 @@ gatemux(register int i, register int t, register int e)
 	}
 }
 
-bus_t
-busnot(bus_t a)
+/*	Bus routines...
+	a bus is BUSWIDTH wire numbers in an array the caller owns;
+	each routine fills in its result r, which must not be one
+	of its operands.
+*/
+void
+busnot(register int *r, register int *a)
 {
 	register int i;
-	bus_t r;
 
 	forbus(i) {
-		r.wire[i] = gatenot(a.wire[i]);
+		r[i] = gatenot(a[i]);
 	}
-	return(r);
 }
 
-bus_t
-busaddc(int carry, bus_t a, bus_t b)
+/*	Parallel-prefix adders...
+	bit i generates a carry (g) or propagates one (p), and the
+	carry out of bit i is g of the span 0..i, spans combining as
+	(g1, p1) o (g0, p0) = (g1 | (p1 & g0), p1 & p0).  Kogge-Stone
+	combines at every distance for the least depth, Brent-Kung
+	goes up a tree and back down for the fewest gates, and
+	Han-Carlson does Kogge-Stone on the odd bits only, then
+	finishes the even bits with one more level.
+*/
+static void
+prefix(register int *g, register int *p, register int i, register int j)
+{
+	/* Span ending at bit i takes in the one ending at bit j */
+	g[i] = gateor(g[i], gateand(p[i], g[j]));
+	p[i] = gateand(p[i], p[j]);
+}
+
+static void
+busaddp(register int *r, int kind, int carry, register int *a, register int *b)
+{
+	register int i, d, n = (BUSWIDTH - 1);
+	int g[MAXWIDTH], p[MAXWIDTH];
+
+	forbus(i) {
+		r[i] = (p[i] = gatexor(a[i], b[i]));
+		g[i] = gateand(a[i], b[i]);
+	}
+
+	/* Fold the carry in; nothing propagates past it */
+	g[0] = gateor(g[0], gateand(p[0], carry));
+	p[0] = 0;
+
+	/* Carries out of bits 0 to n-1; the top bit's is unused */
+	switch (kind) {
+	case ADDKOGGE:
+		for (d=1; d<n; d+=d) {
+			for (i=n-1; i>=d; --i) prefix(g, p, i, i-d);
+		}
+		break;
+	case ADDBRENT:
+		for (d=1; d<n; d+=d) {
+			for (i=d+d-1; i<n; i+=d+d) prefix(g, p, i, i-d);
+		}
+		for (d=1; (d+d)<n; d+=d) ;
+		for (d/=2; d>0; d/=2) {
+			for (i=d+d+d-1; i<n; i+=d+d) prefix(g, p, i, i-d);
+		}
+		break;
+	case ADDHAN:
+		for (i=1; i<n; i+=2) prefix(g, p, i, i-1);
+		for (d=2; d<n; d+=d) {
+			for (i=(n-1-(n&1)); i>=d; i-=2) prefix(g, p, i, i-d);
+		}
+		for (i=2; i<n; i+=2) prefix(g, p, i, i-1);
+		break;
+	}
+
+	r[0] = gatexor(r[0], carry);
+	for (i=1; i<BUSWIDTH; ++i) {
+		r[i] = gatexor(r[i], g[i-1]);
+	}
+}
+
+void
+busaddc(register int *r, int carry, register int *a, register int *b)
 {
 	register int i, x;
-	bus_t r;
+
+	if (adder > ADDRIPPLE) {
+		busaddp(r, adder, carry, a, b);
+		return;
+	}
 
 	/* Add, without carry out */
 	for (i=0; i<(BUSWIDTH-1); ++i) {
-		x = gatexor(a.wire[i], b.wire[i]);
-		r.wire[i] = gatexor(carry, x);
-		carry = gateor(gateand(carry, x), gateand(a.wire[i], b.wire[i]));
+		x = gatexor(a[i], b[i]);
+		r[i] = gatexor(carry, x);
+		carry = gateor(gateand(carry, x), gateand(a[i], b[i]));
 	}
-	x = gatexor(a.wire[i], b.wire[i]);
-	r.wire[i] = gatexor(carry, x);
-
-	return(r);
+	x = gatexor(a[i], b[i]);
+	r[i] = gatexor(carry, x);
 }
 
-bus_t
-busmul(bus_t a,
-bus_t b)
+void
+busmul(register int *r, register int *a, register int *b)
 {
-	/* Not currently used... but we could multiply */
-	register int i, j;
-	bus_t r;
-
-	for (i=0; i<BUSWIDTH; ++i) {
-		r.wire[i] = 0;
+	/* Dadda tree multiplier for the low BUSWIDTH bits:  full and
+	   half adders cut the columns of partial products down to
+	   heights ..., 9, 6, 4, 3, 2, carries going up a column, and
+	   a prefix adder sums the two rows left
+	*/
+	int col[2][MAXWIDTH][MAXWIDTH], n[2][MAXWIDTH];
+	register int c, d, h, i, k, o = 0;
+	register int *w;
+	int x, carry;
+	int r0[MAXWIDTH], r1[MAXWIDTH];
+
+	forbus (c) n[0][c] = 0;
+	forbus (i) {
+		for (c=i; c<BUSWIDTH; ++c) {
+			col[0][c][(n[0][c])++] = gateand(a[c-i], b[i]);
+		}
 	}
-	for (i=0; i<BUSWIDTH; ++i) {
-		/* Add r += a if b */
-		if (b.wire[i] == 1) {
-			r = busaddc(0, r, a);
-		} else if (b.wire[i] != 0) {
-			bus_t a2;
-			for (j=0; j<BUSWIDTH; ++j) {
-				a2.wire[j] = gateand(a.wire[j], b.wire[i]);
+
+	for (;;) {
+		for (h=0, c=0; c<BUSWIDTH; ++c) if (n[o][c] > h) h = n[o][c];
+		if (h <= 2) break;
+		for (d=2; ((d * 3) / 2) < h; d=((d * 3) / 2)) ;
+
+		/* Squeeze each column to height d */
+		forbus (c) n[!o][c] = 0;
+		forbus (c) {
+			w = col[o][c];
+			for (k=0; (n[o][c] - k + n[!o][c]) > d; ) {
+				x = gatexor(w[k], w[k+1]);
+				if ((n[o][c] - k + n[!o][c]) == (d + 1)) {
+					carry = gateand(w[k], w[k+1]);
+					k += 2;
+				} else {
+					carry = gateor(gateand(w[k], w[k+1]), gateand(w[k+2], x));
+					x = gatexor(x, w[k+2]);
+					k += 3;
+				}
+				col[!o][c][(n[!o][c])++] = x;
+				if ((c + 1) < BUSWIDTH) col[!o][c+1][(n[!o][c+1])++] = carry;
 			}
-			r = busaddc(0, r, a2);
+			while (k < n[o][c]) col[!o][c][(n[!o][c])++] = w[k++];
 		}
+		o = !o;
+	}
 
-		/* Shift a <<= 1 */
-		for (j=BUSWIDTH-1; j>0; --j) {
-			a.wire[j] = a.wire[j-1];
-		}
-		a.wire[0] = 0;
+	forbus (c) {
+		r0[c] = ((n[o][c] > 0) ? col[o][c][0] : 0);
+		r1[c] = ((n[o][c] > 1) ? col[o][c][1] : 0);
 	}
+	busaddp(r, ((adder > ADDRIPPLE) ? adder : ADDBRENT), 0, r0, r1);
+}
 
-	return(r);
+void
+busvars(void)
+{
+	/* Give each var BUSWIDTH wires per element, standing for
+	   its own bits, except that STATE goes to 0 unless set
+	*/
+	register var *p;
+	register int i, n;
+
+	for (p=&(symtab[0]); p<&(symtab[MAXV]); ++p) {
+		if ((p->type == WORD) && (p->bus == 0)) {
+			n = (BUSWIDTH * p->dim);
+			if ((p->bus = ((int *) malloc(n * sizeof(int)))) == 0) {
+				error("out of memory for var buses");
+				exit(1);
+			}
+			for (i=0; i<n; ++i) {
+				p->bus[i] = ((p == statevar) ? 0 : (VARPTR2NUM(p) + i));
+			}
+		}
+	}
 }
 
-bus_t
-busconst(int v)
+void
+busconst(register int *r, int v)
 {
-	bus_t bus;
 	register int i;
 
 	forbus(i) {
 		/* Constants are 0 or 1 for each wire */
-		bus.wire[i] = ((v & (1 << i)) != 0);
+		r[i] = KBIT(v, i);
 	}
-	return(bus);
 }
 
-bus_t
-busloadx(var *varg, int sub)
+void
+busknown(register int *r, unsigned long long k0, unsigned long long k1)
+{
+	/* Wires of r known to be 0 (k0) or 1 (k1) become constants */
+	register int i;
+
+	forbus(i) {
+		if ((k0 >> i) & 1) r[i] = 0;
+		if ((k1 >> i) & 1) r[i] = 1;
+	}
+}
+
+void
+busloadx(register int *r, var *varg, int sub)
 {
 	/* Load a constant subscripted variable */
 	register int vnum = VARPTR2NUM(varg);
-	bus_t bus;
 	register int i;
 
 	sub *= BUSWIDTH;
-	forbus (i) bus.wire[i] = vnum + i + sub;
-	return(bus);
+	forbus (i) r[i] = vnum + i + sub;
 }
 
-bus_t
-busload(var *varg)
+void
+busload(register int *r, var *varg)
 {
 	/* Load a variable */
-	return(busloadx(varg, 0));
+	busloadx(r, varg, 0);
 }
 
-bus_t
-busstorex(int guard, var *varg, bus_t bus, int sub)
+void
+busstorex(register int *r, int guard, var *varg, register int *bus, int sub)
 {
-	/* Store a variable if guard */
-	register int vnum = VARPTR2NUM(varg);
+	/* Store a variable if guard; r, if any, gets its new value */
+	register int *w = (varg->bus + (sub * BUSWIDTH));
 	register int i;
 
-	sub *= BUSWIDTH;
-	forbus (i) varg->bus.wire[i + sub] = gatemux(guard,
-						     bus.wire[i],
-						     varg->bus.wire[i + sub]);
-	return(varg->bus);
+	forbus (i) w[i] = gatemux(guard, bus[i], w[i]);
+	if (r) memcpy(r, w, BUSWIDTH * sizeof(int));
 }
 
-bus_t
-busstore(int guard, var *varg, bus_t bus)
+void
+busstore(register int *r, int guard, var *varg, register int *bus)
 {
 	/* Store a variable if guard */
-	return(busstorex(guard, varg, bus, 0));
+	busstorex(r, guard, varg, bus, 0);
 }
 
 int
@@ -283,7 +482,7 @@ stateguard(int state)
 	register int vnum = VARPTR2NUM(statevar);
 	register int i, g = 1;
 
-	forbusrev (i) g = gateand(g, gatexor(vnum+i, ((state & (1<<i)) ? 0 : 1)));
+	forbusrev (i) g = gateand(g, gatexor(vnum+i, !KBIT(state, i)));
 	return(g);
 }
 
@@ -291,97 +490,108 @@ void
 buslab(int guard, int t)
 {
 	/* Lab on next block */
-	busstore(guard, statevar, busconst(t));
+	int bust[MAXWIDTH];
+
+	busconst(bust, t);
+	busstore(0, guard, statevar, bust);
 }
 
 void
-bussel(int guard, bus_t bus, int t, int e)
+bussel(int guard, register int *bus, int t, int e)
 {
-	/* Select operation */
-	register int i, a = bus.wire[0];
-	bus_t bust = busconst(t);
-	bus_t buse = busconst(e);
-
-	forbus (i) a = gateor(a, bus.wire[i]);
-	forbus (i) bust.wire[i] = gatemux(a, bust.wire[i], buse.wire[i]);
-	busstore(guard, statevar, bust);
+	/* Select operation; no bus means take e */
+	register int i, a = 0;
+	int bust[MAXWIDTH], buse[MAXWIDTH];
+
+	busconst(bust, t);
+	busconst(buse, e);
+	if (bus) {
+		a = bus[0];
+		forbus (i) a = gateor(a, bus[i]);
+	}
+	forbus (i) bust[i] = gatemux(a, bust[i], buse[i]);
+	busstore(0, guard, statevar, bust);
 }
 
-bus_t
-busop(opcode op, bus_t arg0, bus_t arg1)
+void
+busop(opcode op, register int *r, register int *arg0, register int *arg1)
 {
-	bus_t bus;
 	register int i, j, k;
+	int t[MAXWIDTH];
 
 	switch (op) {
 	case ADD:
-		bus = busaddc(0, arg0, arg1);
-		return(bus);
+		busaddc(r, 0, arg0, arg1);
+		return;
 	case SUB:
-		bus = busaddc(1, arg0, busnot(arg1));
-		return(bus);
+		busnot(t, arg1);
+		busaddc(r, 1, arg0, t);
+		return;
 	case AND:
-		forbus (i){ bus.wire[i] = gateand(arg0.wire[i], arg1.wire[i]);}
-		return(bus);
+		forbus (i){ r[i] = gateand(arg0[i], arg1[i]);}
+		return;
 	case OR:
-		forbus (i) {bus.wire[i] = gateor(arg0.wire[i], arg1.wire[i]);}
-		return(bus);
+		forbus (i) {r[i] = gateor(arg0[i], arg1[i]);}
+		return;
 	case XOR:
-		forbus (i) {bus.wire[i] = gatexor(arg0.wire[i], arg1.wire[i]);}
-		return(bus);
+		forbus (i) {r[i] = gatexor(arg0[i], arg1[i]);}
+		return;
 	case GT:
 		/* Signed greater by (arg1-arg0) is negative */
-		bus = busaddc(1, arg1, busnot(arg0));
-		i = bus.wire[BUSWIDTH-1];
-		bus = busconst(0);
-		bus.wire[0] = i;
-		return(bus);
+		busnot(t, arg0);
+		busaddc(r, 1, arg1, t);
+		i = r[BUSWIDTH-1];
+		busconst(r, 0);
+		r[0] = i;
+		return;
 	case GE:
 		/* Signed greater equal by (arg0-arg1) is non-negative */
-		bus = busaddc(1, arg0, busnot(arg1));
-		i = bus.wire[BUSWIDTH-1];
-		bus = busconst(0);
-		bus.wire[0] = gatenot(i);
-		return(bus);
+		busnot(t, arg1);
+		busaddc(r, 1, arg0, t);
+		i = r[BUSWIDTH-1];
+		busconst(r, 0);
+		r[0] = gatenot(i);
+		return;
 	case EQ:
 		/* Xor and then tree reduce */
-		forbus (i) bus.wire[i] = gatexor(arg0.wire[i], arg1.wire[i]);
+		forbus (i) r[i] = gatexor(arg0[i], arg1[i]);
 		for (i=1; i<BUSWIDTH; i+=i) {
 			for (j=0; (j+i)<BUSWIDTH; j+=i) {
-				bus.wire[j] = gateor(bus.wire[j], bus.wire[j+i]);
+				r[j] = gateor(r[j], r[j+i]);
 			}
 		}
-		bus.wire[i] = gatenot(bus.wire[i]);
-		for (i=1; i<BUSWIDTH; ++i) bus.wire[i] = 0;
-		return(bus);
+		r[0] = gatenot(r[0]);
+		for (i=1; i<BUSWIDTH; ++i) r[i] = 0;
+		return;
 	case SSL:
-		/* Barrel shifter */
-		forbus (j) bus.wire[j] = arg0.wire[j];
-		for (i=0; i<BUSWIDTH; ++i) {
-			forbus (j) {
-				/* Sign extend logic */
-				k = j + i;
-				if (k >= BUSWIDTH) k = BUSWIDTH-1;
-				bus.wire[j] = gatemux(arg1.wire[i],
-						      bus.wire[k],
-						      bus.wire[j]);
-			}
-		}
-		return(bus);
 	case SSR:
-		/* Barrel shifter */
-		forbus (j) bus.wire[j] = arg0.wire[j];
-		for (i=0; i<BUSWIDTH; ++i) {
-			forbus (j) {
-				bus.wire[j] = gatemux(arg1.wire[i],
-						      ((j > i) ? 0 : bus.wire[k]),
-						      bus.wire[j]);
+		/* Barrel shifter, stage i moving 2**i bits if count bit i;
+		   shifting right copies the sign in at the top
+		*/
+		memcpy(r, arg0, BUSWIDTH * sizeof(int));
+		for (i=0, k=1; i<BUSWIDTH; ++i) {
+			if (op == SSL) {
+				for (j=BUSWIDTH-1; j>=0; --j) {
+					r[j] = gatemux(arg1[i],
+						       ((j >= k) ? r[j-k] : 0),
+						       r[j]);
+				}
+			} else {
+				forbus (j) {
+					r[j] = gatemux(arg1[i],
+						       r[((j + k) < BUSWIDTH) ? (j + k) : (BUSWIDTH - 1)],
+						       r[j]);
+				}
 			}
+			if (k < BUSWIDTH) k += k;
 		}
-		return(bus);
+		return;
+	case MUL:
+		busmul(r, arg0, arg1);
+		return;
 	}
 
-	return(arg0);
+	memcpy(r, arg0, BUSWIDTH * sizeof(int));
 }
 
 
@@ -390,53 +600,77 @@ recurmark(register int i)
 {
 	/* Recursively mark needed vars and gates */
 	if (i >= VARBIAS) return;
-	if (++(gate[i].needed) > 1) return;
+	if (gate[i].needed) return;
+	gate[i].needed = 1;
 	recurmark(gate[i].arg0);
 	recurmark(gate[i].arg1);
 }
 
-char *
-gatename(register int a)
+static void
+outvar(register out_t *o, register int a, register char *b0, register char *b1)
 {
-	/* Convert gate a into a printable string */
-	static char namestr[1024];
+	/* Var wire a, as name_deflev_defblk, then bit b0 bit b1 */
+	register var *p = NUM2VARPTR(a);
+
+	outs(o, p->text);
+	outc(o, '_');
+	outd(o, p->deflev);
+	outc(o, '_');
+	outd(o, p->defblk);
+	outs(o, b0);
+	outd(o, NUM2VARBIT(a));
+	outs(o, b1);
+}
 
+static void
+gatename(register out_t *o, register int a)
+{
+	/* Name of gate a */
 	if (a < 2) {
-		sprintf(namestr, "_%u", a);
+		outc(o, '_');
+		outu(o, a);
 	} else if (a < VARBIAS) {
-		sprintf(namestr, "G%u", gate[a].newno);
+		outc(o, 'G');
+		outu(o, gate[a].newno);
 	} else {
-		var *p = NUM2VARPTR(a);
-		sprintf(namestr,
-			"%s_%d_%d_%d",
-			p->text,
-			p->deflev,
-			p->defblk,
-			(a % VARBIAS));
+		outvar(o, a, "_", "");
 	}
-	return(namestr);
 }
 
-char *
-vname(register int a)
+static void
+vname(register out_t *o, register int a)
 {
-	/* Convert gate a into a verilog name */
-	static char namestr[1024];
-
+	/* Verilog name of gate a */
 	if (a < 2) {
-		sprintf(namestr, "%u", a);
+		outu(o, a);
 	} else if (a < VARBIAS) {
-		sprintf(namestr, "w[%d]", gate[a].newno-2);
+		outs(o, "w[");
+		outd(o, gate[a].newno-2);
+		outc(o, ']');
 	} else {
-		var *p = NUM2VARPTR(a);
-		sprintf(namestr,
-			"%s_%d_%d[%d]",
-			p->text,
-			p->deflev,
-			p->defblk,
-			(a % VARBIAS));
+		outvar(o, a, "[", "]");
 	}
-	return(namestr);
+}
+
+static void
+dotnode(register out_t *o, register int a, register char *pre)
+{
+	/* pre+name [label="pre+name"]; */
+	outs(o, pre);
+	gatename(o, a);
+	outs(o, " [label=\"");
+	outs(o, pre);
+	gatename(o, a);
+	outs(o, "\"];\n");
+}
+
+static void
+dotedge(register out_t *o, register char *hue)
+{
+	/* End of an arc, colored hue */
+	outs(o, " [color=\"");
+	outs(o, hue);
+	outs(o, ",1.0,1.0\"];\n");
 }
 
 static char *
@@ -452,15 +686,817 @@ gatefunc(opcode op)
 	return("BADOP");
 }
 
+/*	Bit-parallel simulation of the needed gates...
+	each lanes_t word carries one wire for SIMLANES independent
+	runs, so one pass over the netlist clocks all of them at once
+*/
+typedef	unsigned long long	lanes_t;
+#define	SIMLANES	64
+#define	SIMCYCLES	100000	/* give up on lanes that never halt */
+
+typedef struct {
+	opcode	op;		/* gate function */
+	int	d, a0, a1;	/* value slots of result and operands */
+} simop_t;
+
+static	int	*simreg = 0;	/* first register slot of each var */
+static	int	simgate;	/* gate slot minus newno, past the registers */
+
+static int
+simslot(register int a)
+{
+	/* Value slot holding wire a */
+	if (a < 2) return(a);
+	if (a >= VARBIAS) {
+		return(simreg[(a - VARBIAS) / VARSPAN] + NUM2VARBIT(a));
+	}
+	return(simgate + gate[a].newno);
+}
+
+static int
+simlayout(void)
+{
+	/* Lay out register slots: constants first, then each var */
+	register int i, nreg = 2;
+
+	if (simreg == 0) simreg = ((int *) malloc(MAXV * sizeof(int)));
+	if (simreg == 0) {
+		fprintf(stderr, "out of memory for simulation\n");
+		exit(1);
+	}
+	for (i=0; i<MAXV; ++i) {
+		if (symtab[i].type == WORD) {
+			simreg[i] = nreg;
+			nreg += (BUSWIDTH * symtab[i].dim);
+		}
+	}
+	simgate = nreg - 2;	/* newno 2 is the first gate */
+	return(nreg);
+}
+
+static lanes_t
+simrand(void)
+{
+	/* Deterministic xorshift stimulus, so runs are repeatable */
+	static lanes_t x = 0x9e3779b97f4a7c15ULL;
+
+	x ^= (x << 13);
+	x ^= (x >> 7);
+	x ^= (x << 17);
+	return(x);
+}
+
+static void
+simprint(register out_t *o, lanes_t *val, register int lane)
+{
+	/* Print every var element as a signed BUSWIDTH-bit value */
+	register int i, j, k;
+
+	for (i=0; i<MAXV; ++i) {
+		if (symtab[i].type == WORD) {
+			for (k=0; k<symtab[i].dim; ++k) {
+				register unsigned long long v = 0;
+
+				forbusrev (j) {
+					v = ((v << 1) |
+					     ((val[simreg[i] + (k * BUSWIDTH) + j] >> lane) & 1));
+				}
+				v <<= (64 - BUSWIDTH);
+				outc(o, (k ? ',' : '\t'));
+				outd(o, (((long long) v) >> (64 - BUSWIDTH)));
+			}
+		}
+	}
+	outc(o, '\n');
+}
+
+static void
+simheader(register out_t *o, char *first)
+{
+	register int i;
+
+	outs(o, first);
+	for (i=0; i<MAXV; ++i) {
+		if (symtab[i].type == WORD) {
+			outc(o, '\t');
+			outs(o, symtab[i].text);
+			outc(o, '_');
+			outd(o, symtab[i].deflev);
+			outc(o, '_');
+			outd(o, symtab[i].defblk);
+		}
+	}
+	outc(o, '\n');
+}
+
+/*	Test vectors (-i)...
+	the file looks like the tables -x prints: a header line
+	starting with "lane" names the columns, either as printed
+	(a_1_1) or just by var name, and each line after it is one
+	vector, array elements separated by commas.  Columns for
+	lane, cycles and STATE are skipped, vars not named start at
+	0, and a new header may appear anywhere, so -x output can be
+	read back in as it is.
+*/
+static	int	*simcol = 0;		/* var of each column, or -1 to skip */
+static	int	simncol = 0;
+
+static int
+simvar(register char *name)
+{
+	/* Var named name, or -1 if it is a column to skip */
+	char buf[256];
+	register int i;
+
+	if (!strcmp(name, "lane") || !strcmp(name, "cycles")) return(-1);
+	for (i=0; i<MAXV; ++i) {
+		if (symtab[i].type == WORD) {
+			snprintf(buf, sizeof(buf), "%s_%d_%d",
+				 symtab[i].text, symtab[i].deflev, symtab[i].defblk);
+			if (!strcmp(name, buf) || !strcmp(name, symtab[i].text)) {
+				return((&(symtab[i]) == statevar) ? -1 : i);
+			}
+		}
+	}
+	fprintf(stderr, "%s: no var named %s\n", simin, name);
+	exit(1);
+}
+
+static lanes_t
+simread(register FILE *in, lanes_t *val)
+{
+	/* Load up to SIMLANES vectors from in into the registers;
+	   returns which lanes got one
+	*/
+	static char *line = 0;
+	static size_t size = 0;
+	register char *p;
+	register int c, e, i, j, k = 0;
+	char *q;
+	long long v;
+
+	while ((k < SIMLANES) && (getline(&line, &size, in) >= 0)) {
+		p = strtok(line, " \t\r\n");
+		if ((p == 0) || !strncmp(p, "//", 2)) continue;
+
+		if (!strcmp(p, "lane")) {
+			/* New header */
+			for (simncol=0; p; p=strtok(0, " \t\r\n")) {
+				simcol = ((int *) realloc(simcol, (simncol + 1) * sizeof(int)));
+				if (simcol == 0) {
+					fprintf(stderr, "out of memory for simulation\n");
+					exit(1);
+				}
+				simcol[simncol++] = simvar(p);
+			}
+			continue;
+		}
+		if (simncol == 0) {
+			fprintf(stderr, "%s: vectors before a lane header\n", simin);
+			exit(1);
+		}
+
+		for (c=0; p; ++c, p=strtok(0, " \t\r\n")) {
+			if ((c >= simncol) || ((i = simcol[c]) < 0)) continue;
+			for (e=0; ; ++e) {
+				v = strtoll(p, &q, 0);
+				if ((q == p) || (e >= symtab[i].dim)) {
+					fprintf(stderr, "%s: bad value %s for %s\n", simin, p, symtab[i].text);
+					exit(1);
+				}
+				forbus (j) {
+					if ((v >> ((j < 63) ? j : 63)) & 1) {
+						val[simreg[i] + (e * BUSWIDTH) + j] |= (((lanes_t) 1) << k);
+					}
+				}
+				if (*q != ',') break;
+				p = q + 1;
+			}
+		}
+		++k;
+	}
+	return((k < SIMLANES) ? ((((lanes_t) 1) << k) - 1) : ~((lanes_t) 0));
+}
+
+static void
+simgates(int haltstate, int maxlevel)
+{
+	register int i, j, k, n;
+	register lanes_t halt, done, used;
+	int nreg = simlayout(), nop = 0, nupd = 0, cycle, first;
+	int *count, *upd;
+	simop_t *prog;
+	lanes_t *val, *next;
+	int cycles[SIMLANES];
+	FILE *in = 0;
+	out_t fin;
+
+	val = ((lanes_t *) calloc(nreg + gatesneed, sizeof(lanes_t)));
+	next = ((lanes_t *) calloc(nreg, sizeof(lanes_t)));
+	prog = ((simop_t *) malloc((gatesneed + 1) * sizeof(simop_t)));
+	count = ((int *) calloc(maxlevel + 2, sizeof(int)));
+	upd = ((int *) malloc(2 * (nreg + 1) * sizeof(int)));
+	if ((val == 0) || (next == 0) ||
+	    (prog == 0) || (count == 0) || (upd == 0)) {
+		fprintf(stderr, "out of memory for simulation\n");
+		exit(1);
+	}
+	if (simin && ((in = fopen(simin, "r")) == 0)) {
+		perror(simin);
+		exit(1);
+	}
+
+	/* Bucket needed gates by level; index order within a level */
+	for (i=2; i<gatesp; ++i) {
+		if (gate[i].needed) ++count[gate[i].level];
+	}
+	for (k=0, j=0; k<=maxlevel; ++k) {
+		n = count[k];
+		count[k] = j;
+		j += n;
+	}
+	for (i=2; i<gatesp; ++i) {
+		if (gate[i].needed) {
+			simop_t *s = &(prog[count[gate[i].level]++]);
+
+			s->op = gate[i].op;
+			s->d = simslot(i);
+			s->a0 = simslot(gate[i].arg0);
+			s->a1 = simslot(gate[i].arg1);
+			++nop;
+		}
+	}
+
+	/* Clocked updates: register slot <= source slot */
+	for (i=0; i<MAXV; ++i) {
+		if (symtab[i].type == WORD) {
+			forbus (j) {
+				if (symtab[i].bus[j] != (VARPTR2NUM(&(symtab[i])) + j)) {
+					upd[nupd++] = simreg[i] + j;
+					upd[nupd++] = simslot(symtab[i].bus[j]);
+				}
+			}
+		}
+	}
+
+	/* Initial values print as each batch loads; final ones wait */
+	outinit(&fin, 0);
+	simheader(&out, "// initial\nlane");
+	val[0] = 0;
+	val[1] = ~((lanes_t) 0);
+	for (first=0; ; first+=SIMLANES) {
+		/* Stimulus: STATE starts at 0; without -i, one batch
+		   with lane 0 all zero and the others random
+		*/
+		memset(val + 2, 0, (nreg - 2) * sizeof(lanes_t));
+		if (in) {
+			if ((used = simread(in, val)) == 0) break;
+		} else {
+			if (first > 0) break;
+			used = ~((lanes_t) 0);
+			for (i=0; i<MAXV; ++i) {
+				if ((symtab[i].type == WORD) && (&(symtab[i]) != statevar)) {
+					for (j=0; j<(BUSWIDTH * symtab[i].dim); ++j) {
+						val[simreg[i] + j] = (simrand() & ~((lanes_t) 1));
+					}
+				}
+			}
+		}
+		for (k=0; k<SIMLANES; ++k) {
+			if (used & (((lanes_t) 1) << k)) {
+				outd(&out, first + k);
+				simprint(&out, val, k);
+			}
+		}
+
+		/* Clock until every lane reaches the halt state;
+		   lanes without a vector count as done
+		*/
+		done = ~used;
+		for (cycle=0; ; ++cycle) {
+			halt = ~((lanes_t) 0);
+			forbus (j) {
+				lanes_t s = val[simreg[statevar - symtab] + j];
+				halt &= (KBIT(haltstate, j) ? s : ~s);
+			}
+			for (k=0; k<SIMLANES; ++k) {
+				if ((halt & ~done) & (((lanes_t) 1) << k)) cycles[k] = cycle;
+			}
+			done |= halt;
+			if ((done == ~((lanes_t) 0)) || (cycle >= SIMCYCLES)) break;
+
+			for (i=0; i<nop; ++i) {
+				register simop_t *s = &(prog[i]);
+				register lanes_t a0 = val[s->a0];
+				register lanes_t a1 = val[s->a1];
+
+				switch (s->op) {
+				case AND:	val[s->d] = (a0 & a1); break;
+				case OR:	val[s->d] = (a0 | a1); break;
+				case XOR:	val[s->d] = (a0 ^ a1); break;
+				case NAND:	val[s->d] = ~(a0 & a1); break;
+				case NOR:	val[s->d] = ~(a0 | a1); break;
+				}
+			}
+
+			/* All registers load at once, halted lanes hold */
+			for (i=0; i<nupd; i+=2) next[upd[i]] = val[upd[i+1]];
+			for (i=0; i<nupd; i+=2) {
+				val[upd[i]] = ((val[upd[i]] & done) | (next[upd[i]] & ~done));
+			}
+		}
+
+		for (k=0; k<SIMLANES; ++k) {
+			if (used & (((lanes_t) 1) << k)) {
+				outd(&fin, first + k);
+				outc(&fin, '\t');
+				outd(&fin, ((done & (((lanes_t) 1) << k)) ? cycles[k] : -1));
+				simprint(&fin, val, k);
+			}
+		}
+	}
+
+	simheader(&out, "// final\nlane\tcycles");
+	outw(&out, fin.buf, fin.n);
+	outfree(&fin);
+	if (in) fclose(in);
+
+	free(val);
+	free(next);
+	free(prog);
+	free(count);
+	free(upd);
+}
+
+static char *
+cfunc(opcode op)
+{
+	/* Gate function as an evaluator macro */
+	switch (op) {
+	case AND:	return("AND");
+	case OR:	return("OR");
+	case XOR:	return("XOR");
+	case NAND:	return("NAND");
+	case NOR:	return("NOR");
+	}
+	return("BADOP");
+}
+
+static void
+cname(register out_t *o, register int a)
+{
+	/* Name wire a in the generated C evaluator */
+	if (a < 2) {
+		outs(o, (a ? "ONES" : "ZERO"));
+	} else if (a >= VARBIAS) {
+		outs(o, "R(");
+		outd(o, simslot(a) - 2);
+		outc(o, ')');
+	} else {
+		outs(o, "w[");
+		outd(o, gate[a].newno - 2);
+		outc(o, ']');
+	}
+}
+
+#define	CPARTLINES	128	/* statements per evaluator function */
+
+static	int	cparts, clines;
+
+static void
+cline(register out_t *o)
+{
+	/* Start a new PART macro every CPARTLINES statements, so no
+	   single function is too big for the C compiler to optimize
+	*/
+	if ((clines == 0) || (clines >= CPARTLINES)) {
+		outs(o, "\n#define\tPART");
+		outd(o, cparts++);
+		outs(o, " \\\n");
+		clines = 0;
+	}
+	++clines;
+}
+
+static void
+dumpeval(int haltstate, int maxlevel)
+{
+	/* Standalone C evaluator for the needed gates...
+	   the netlist is emitted once as PART macros and expanded
+	   for AVX-512, AVX2, and plain 64-bit words, one picked at
+	   run time
+	*/
+	register int i, j, k, nupd = 0;
+	int nreg = simlayout() - 2;
+
+	cparts = 0;
+	clines = 0;
+
+	outs(&out, "/*\tGate-level evaluator generated by bbgates -c\n"
+	           "\n"
+	           "\tEach register bit is NW 64-bit words holding one bit\n"
+	           "\tof each of NLANES independent runs\n"
+	           "*/\n"
+	           "\n"
+	           "#include <stdio.h>\n"
+	           "#include <string.h>\n"
+	           "\n"
+	           "#if defined(__x86_64__) && defined(__GNUC__)\n"
+	           "#define\tBB_X86\t1\n"
+	           "#include <immintrin.h>\n"
+	           "#endif\n"
+	           "\n"
+	           "#ifdef\t__GNUC__\n"
+	           "#define\tNOINLINE\t__attribute__((noinline))\n"
+	           "#else\n"
+	           "#define\tNOINLINE\n"
+	           "#endif\n"
+	           "\n"
+	           "typedef\tunsigned long long\tu64;\n"
+	           "\n"
+	           "#define\tNREG\t");
+	outd(&out, nreg);
+	outs(&out, "\t/* register bits */\n"
+	           "#define\tNWIRE\t");
+	outd(&out, ((gatesneed > 2) ? (gatesneed - 2) : 1));
+	outs(&out, "\t/* gate outputs */\n"
+	           "#define\tNW\t8\t/* words per bit */\n"
+	           "#define\tNLANES\t(NW * 64)\n"
+	           "#define\tBUSWIDTH\t");
+	outd(&out, BUSWIDTH);
+	outs(&out, "\n"
+	           "#define\tMAXCYCLES\t");
+	outd(&out, SIMCYCLES);
+	outs(&out, "\n"
+	           "\n"
+	           "static\tu64\tr[NREG][NW];\t/* registers */\n"
+	           "static\tu64\tdone[NW];\t/* lanes that reached the halt state */\n"
+	           "\n"
+	           "static const struct {\n"
+	           "\tconst char *name;\n"
+	           "\tint base, dim, state;\n"
+	           "} vars[] = {\n");
+	for (i=0; i<MAXV; ++i) {
+		if (symtab[i].type == WORD) {
+			outs(&out, "\t{ \"");
+			outs(&out, symtab[i].text);
+			outc(&out, '_');
+			outd(&out, symtab[i].deflev);
+			outc(&out, '_');
+			outd(&out, symtab[i].defblk);
+			outs(&out, "\", ");
+			outd(&out, simreg[i] - 2);
+			outs(&out, ", ");
+			outd(&out, symtab[i].dim);
+			outs(&out, ", ");
+			outd(&out, (&(symtab[i]) == statevar));
+			outs(&out, " },\n");
+		}
+	}
+	outs(&out, "};\n"
+	           "#define\tNVARS\t((int) (sizeof(vars) / sizeof(vars[0])))\n"
+	           "\n"
+	           "/* One clock of lanes starting at word c, in PARTs */\n"
+	           "#define\tR(i)\tLOAD(r[i] + c)\n"
+	           "#define\tH\tw[NWIRE]\t/* lanes halting now */\n"
+	           "#define\tD\tw[NWIRE + 1]\t/* lanes halted */\n"
+	           "#define\tNAND(a, b)\tXOR(AND(a, b), ONES)\n"
+	           "#define\tNOR(a, b)\tXOR(OR(a, b), ONES)\n");
+
+	/* Halt when STATE matches, then freeze those lanes */
+	cline(&out);
+	outs(&out, "\tH = ONES; \\\n");
+	forbus (j) {
+		cline(&out);
+		outs(&out, (KBIT(haltstate, j) ? "\tH = AND(R(" : "\tH = ANDN(R("));
+		outd(&out, simreg[statevar - symtab] + j - 2);
+		outs(&out, "), H); \\\n");
+	}
+	cline(&out);
+	outs(&out, "\tD = OR(LOAD(done + c), H); \\\n");
+	cline(&out);
+	outs(&out, "\tSTORE(done + c, D); \\\n");
+
+	/* Gates in level order */
+	for (k=1; k<=maxlevel; ++k) {
+		for (i=2; i<gatesp; ++i) {
+			if (gate[i].needed && (gate[i].level == k)) {
+				cline(&out);
+				outs(&out, "\tw[");
+				outd(&out, gate[i].newno - 2);
+				outs(&out, "] = ");
+				outs(&out, cfunc(gate[i].op));
+				outc(&out, '(');
+				cname(&out, gate[i].arg0);
+				outs(&out, ", ");
+				cname(&out, gate[i].arg1);
+				outs(&out, "); \\\n");
+			}
+		}
+	}
+
+	/* Next values, then all registers load at once */
+	for (i=0; i<MAXV; ++i) {
+		if (symtab[i].type == WORD) {
+			forbus (j) {
+				if (symtab[i].bus[j] != (VARPTR2NUM(&(symtab[i])) + j)) {
+					cline(&out);
+					outs(&out, "\tn[");
+					outd(&out, nupd++);
+					outs(&out, "] = ");
+					cname(&out, symtab[i].bus[j]);
+					outs(&out, "; \\\n");
+				}
+			}
+		}
+	}
+	for (i=0, k=0; i<MAXV; ++i) {
+		if (symtab[i].type == WORD) {
+			forbus (j) {
+				if (symtab[i].bus[j] != (VARPTR2NUM(&(symtab[i])) + j)) {
+					cline(&out);
+					outs(&out, "\tSTORE(r[");
+					outd(&out, simreg[i] + j - 2);
+					outs(&out, "] + c, OR(AND(D, R(");
+					outd(&out, simreg[i] + j - 2);
+					outs(&out, ")), ANDN(D, n[");
+					outd(&out, k++);
+					outs(&out, "]))); \\\n");
+				}
+			}
+		}
+	}
+	outs(&out, "\n#define\tPARTS(X, NAME)");
+	for (k=0; k<cparts; ++k) {
+		outs(&out, " \\\n\tX(NAME, ");
+		outd(&out, k);
+		outc(&out, ')');
+	}
+	outs(&out, "\n"
+	           "#define\tPARTFN(NAME, K) \\\n"
+	           "static NOINLINE void NAME##_##K(register int c) { PART##K }\n"
+	           "#define\tPARTCALL(NAME, K)\tNAME##_##K(c);\n"
+	           "\n"
+	           "/* Each STEP has its own wires, named by w and n */\n"
+	           "#define\tNUPD\t");
+	outd(&out, ((nupd > 0) ? nupd : 1));
+	outs(&out, "\n"
+	           "#define\tSTEP(NAME, VW) \\\n"
+	           "static V NAME##_w[NWIRE + 2], NAME##_n[NUPD + 1]; \\\n"
+	           "PARTS(PARTFN, NAME) \\\n"
+	           "static void \\\n"
+	           "NAME(void) \\\n"
+	           "{ \\\n"
+	           "\tregister int c; \\\n"
+	           "\tfor (c=0; c<NW; c+=VW) { PARTS(PARTCALL, NAME) } \\\n"
+	           "}\n"
+	           "\n"
+	           "#ifdef\tBB_X86\n"
+	           "#pragma GCC push_options\n"
+	           "#pragma GCC target(\"avx512f\")\n"
+	           "#define\tV\t__m512i\n"
+	           "#define\tLOAD(p)\t_mm512_loadu_si512((const void *) (p))\n"
+	           "#define\tSTORE(p, v)\t_mm512_storeu_si512((void *) (p), (v))\n"
+	           "#define\tONES\t_mm512_set1_epi64(-1)\n"
+	           "#define\tZERO\t_mm512_setzero_si512()\n"
+	           "#define\tAND(a, b)\t_mm512_and_si512((a), (b))\n"
+	           "#define\tOR(a, b)\t_mm512_or_si512((a), (b))\n"
+	           "#define\tXOR(a, b)\t_mm512_xor_si512((a), (b))\n"
+	           "#define\tANDN(a, b)\t_mm512_andnot_si512((a), (b))\n"
+	           "#define\tw\tstep512_w\n"
+	           "#define\tn\tstep512_n\n"
+	           "STEP(step512, 8)\n"
+	           "#undef\tw\n"
+	           "#undef\tn\n"
+	           "#pragma GCC pop_options\n"
+	           "#undef\tV\n#undef\tLOAD\n#undef\tSTORE\n#undef\tONES\n#undef\tZERO\n"
+	           "#undef\tAND\n#undef\tOR\n#undef\tXOR\n#undef\tANDN\n"
+	           "\n"
+	           "#pragma GCC push_options\n"
+	           "#pragma GCC target(\"avx2\")\n"
+	           "#define\tV\t__m256i\n"
+	           "#define\tLOAD(p)\t_mm256_loadu_si256((const __m256i *) (p))\n"
+	           "#define\tSTORE(p, v)\t_mm256_storeu_si256((__m256i *) (p), (v))\n"
+	           "#define\tONES\t_mm256_set1_epi64x(-1)\n"
+	           "#define\tZERO\t_mm256_setzero_si256()\n"
+	           "#define\tAND(a, b)\t_mm256_and_si256((a), (b))\n"
+	           "#define\tOR(a, b)\t_mm256_or_si256((a), (b))\n"
+	           "#define\tXOR(a, b)\t_mm256_xor_si256((a), (b))\n"
+	           "#define\tANDN(a, b)\t_mm256_andnot_si256((a), (b))\n"
+	           "#define\tw\tstep256_w\n"
+	           "#define\tn\tstep256_n\n"
+	           "STEP(step256, 4)\n"
+	           "#undef\tw\n"
+	           "#undef\tn\n"
+	           "#pragma GCC pop_options\n"
+	           "#undef\tV\n#undef\tLOAD\n#undef\tSTORE\n#undef\tONES\n#undef\tZERO\n"
+	           "#undef\tAND\n#undef\tOR\n#undef\tXOR\n#undef\tANDN\n"
+	           "#endif\n"
+	           "\n"
+	           "#define\tV\tu64\n"
+	           "#define\tLOAD(p)\t(*(p))\n"
+	           "#define\tSTORE(p, v)\t(*(p) = (v))\n"
+	           "#define\tONES\t(~0ULL)\n"
+	           "#define\tZERO\t0ULL\n"
+	           "#define\tAND(a, b)\t((a) & (b))\n"
+	           "#define\tOR(a, b)\t((a) | (b))\n"
+	           "#define\tXOR(a, b)\t((a) ^ (b))\n"
+	           "#define\tANDN(a, b)\t(~(a) & (b))\n"
+	           "#define\tw\tstep64_w\n"
+	           "#define\tn\tstep64_n\n"
+	           "STEP(step64, 1)\n"
+	           "#undef\tw\n"
+	           "#undef\tn\n"
+	           "\n"
+	           "static u64\n"
+	           "rnd(void)\n"
+	           "{\n"
+	           "\t/* Same stimulus as bbgates -x for the first 64 lanes */\n"
+	           "\tstatic u64 x = 0x9e3779b97f4a7c15ULL;\n"
+	           "\n"
+	           "\tx ^= (x << 13);\n"
+	           "\tx ^= (x >> 7);\n"
+	           "\tx ^= (x << 17);\n"
+	           "\treturn(x);\n"
+	           "}\n"
+	           "\n"
+	           "int\n"
+	           "main(int argc, char **argv)\n"
+	           "{\n"
+	           "\tvoid (*step)(void) = step64;\n"
+	           "\tconst char *isa = \"scalar\";\n"
+	           "\tstatic int cycles[NLANES];\n"
+	           "\tint i, j, k, c, cycle, all;\n"
+	           "\n"
+	           "#ifdef\tBB_X86\n"
+	           "\t__builtin_cpu_init();\n"
+	           "\tif ((argc < 2) || strcmp(argv[1], \"scalar\")) {\n"
+	           "\t\tif (__builtin_cpu_supports(\"avx512f\") &&\n"
+	           "\t\t    ((argc < 2) || !strcmp(argv[1], \"avx512\"))) {\n"
+	           "\t\t\tstep = step512;\n"
+	           "\t\t\tisa = \"avx512\";\n"
+	           "\t\t} else if (__builtin_cpu_supports(\"avx2\")) {\n"
+	           "\t\t\tstep = step256;\n"
+	           "\t\t\tisa = \"avx2\";\n"
+	           "\t\t}\n"
+	           "\t}\n"
+	           "#endif\n"
+	           "\n"
+	           "\t/* STATE starts at 0, lane 0 all zero, others random */\n"
+	           "\tfor (c=0; c<NW; ++c) {\n"
+	           "\t\tfor (i=0; i<NVARS; ++i) {\n"
+	           "\t\t\tif (vars[i].state) continue;\n"
+	           "\t\t\tfor (j=0; j<(BUSWIDTH * vars[i].dim); ++j) {\n"
+	           "\t\t\t\tr[vars[i].base + j][c] = (rnd() & (c ? ~0ULL : ~1ULL));\n"
+	           "\t\t\t}\n"
+	           "\t\t}\n"
+	           "\t}\n"
+	           "\n"
+	           "\t/* Clock until every lane halts */\n"
+	           "\tfor (k=0; k<NLANES; ++k) cycles[k] = -1;\n"
+	           "\tfor (cycle=0; cycle<=MAXCYCLES; ++cycle) {\n"
+	           "\t\tu64 old[NW];\n"
+	           "\n"
+	           "\t\tmemcpy(old, done, sizeof(old));\n"
+	           "\t\t(*step)();\n"
+	           "\t\tall = 1;\n"
+	           "\t\tfor (k=0; k<NLANES; ++k) {\n"
+	           "\t\t\tu64 b = (1ULL << (k & 63));\n"
+	           "\n"
+	           "\t\t\tif ((done[k >> 6] & ~old[k >> 6]) & b) cycles[k] = cycle;\n"
+	           "\t\t\tif (!(done[k >> 6] & b)) all = 0;\n"
+	           "\t\t}\n"
+	           "\t\tif (all) break;\n"
+	           "\t}\n"
+	           "\n"
+	           "\tprintf(\"// final (%s)\\nlane\\tcycles\", isa);\n"
+	           "\tfor (i=0; i<NVARS; ++i) printf(\"\\t%s\", vars[i].name);\n"
+	           "\tprintf(\"\\n\");\n"
+	           "\tfor (k=0; k<NLANES; ++k) {\n"
+	           "\t\tprintf(\"%d\\t%d\", k, cycles[k]);\n"
+	           "\t\tfor (i=0; i<NVARS; ++i) {\n"
+	           "\t\t\tfor (c=0; c<vars[i].dim; ++c) {\n"
+	           "\t\t\t\tunsigned long long v = 0;\n"
+	           "\n"
+	           "\t\t\t\tfor (j=BUSWIDTH-1; j>=0; --j) {\n"
+	           "\t\t\t\t\tv = ((v << 1) |\n"
+	           "\t\t\t\t\t     ((r[vars[i].base + (c * BUSWIDTH) + j][k >> 6] >> (k & 63)) & 1));\n"
+	           "\t\t\t\t}\n"
+	           "\t\t\t\tv <<= (64 - BUSWIDTH);\n"
+	           "\t\t\t\tprintf(\"%c%lld\", (c ? ',' : '\\t'), (((long long) v) >> (64 - BUSWIDTH)));\n"
+	           "\t\t\t}\n"
+	           "\t\t}\n"
+	           "\t\tprintf(\"\\n\");\n"
+	           "\t}\n"
+	           "\treturn(0);\n"
+	           "}\n");
+}
+
+static unsigned int
+binwire(register int a, register int *base)
+{
+	/* Netlist wire number of gate or var bit a */
+	if (a < VARBIAS) return((unsigned int) gate[a].newno);
+	return((unsigned int) (base[NUM2VARPTR(a) - symtab] + NUM2VARBIT(a)));
+}
+
+static void
+dumpbin(int haltstate, int maxlevel)
+{
+	/* Binary netlist, as in bbnet.h */
+	bbnet_head_t h;
+	bbnet_gate_t g;
+	bbnet_var_t v;
+	bbnet_out_t o;
+	register int i, j;
+	int base[MAXV];
+	static char pad[4];
+
+	memset(&h, 0, sizeof(h));
+	h.magic = BBNET_MAGIC;
+	h.version = BBNET_VERSION;
+	h.buswidth = BUSWIDTH;
+	h.ngates = gatesneed;
+	h.haltstate = haltstate;
+	h.maxlevel = maxlevel;
+	for (i=0; i<MAXV; ++i) {
+		if (symtab[i].type == WORD) {
+			if (&(symtab[i]) == statevar) h.state = h.nvars;
+			base[i] = gatesneed + h.nbits;
+			h.nbits += (BUSWIDTH * symtab[i].dim);
+			h.nstr += (strlen(symtab[i].text) + 1);
+			++h.nvars;
+			forbus (j) {
+				if (symtab[i].bus[j] != (VARPTR2NUM(&(symtab[i])) + j)) ++h.nouts;
+			}
+		}
+	}
+	h.gates = sizeof(h);
+	h.vars = h.gates + (h.ngates * sizeof(g));
+	h.outs = h.vars + (h.nvars * sizeof(v));
+	h.strs = h.outs + (h.nouts * sizeof(o));
+	h.size = h.strs + ((h.nstr + 3) & ~3);
+	outw(&out, ((char *) &h), sizeof(h));
+
+	/* Gates in newno order */
+	forgates (i) {
+		if (!gate[i].needed) continue;
+		switch (gate[i].op) {
+		case AND:	g.op = BBNET_AND; break;
+		case OR:	g.op = BBNET_OR; break;
+		case XOR:	g.op = BBNET_XOR; break;
+		case NAND:	g.op = BBNET_NAND; break;
+		case NOR:	g.op = BBNET_NOR; break;
+		default:	g.op = ((i == 0) ? BBNET_ZERO : BBNET_ONE);
+		}
+		g.arg0 = ((i < 2) ? ((unsigned int) i) : binwire(gate[i].arg0, base));
+		g.arg1 = ((i < 2) ? ((unsigned int) i) : binwire(gate[i].arg1, base));
+		outw(&out, ((char *) &g), sizeof(g));
+	}
+
+	/* Vars, then the bits they load */
+	for (i=0, j=0; i<MAXV; ++i) {
+		if (symtab[i].type == WORD) {
+			v.name = j;
+			v.deflev = symtab[i].deflev;
+			v.defblk = symtab[i].defblk;
+			v.dim = symtab[i].dim;
+			v.base = base[i];
+			outw(&out, ((char *) &v), sizeof(v));
+			j += (strlen(symtab[i].text) + 1);
+		}
+	}
+	for (i=0; i<MAXV; ++i) {
+		if (symtab[i].type == WORD) {
+			forbus (j) {
+				if (symtab[i].bus[j] != (VARPTR2NUM(&(symtab[i])) + j)) {
+					o.reg = base[i] + j;
+					o.wire = binwire(symtab[i].bus[j], base);
+					outw(&out, ((char *) &o), sizeof(o));
+				}
+			}
+		}
+	}
+	for (i=0; i<MAXV; ++i) {
+		if (symtab[i].type == WORD) {
+			outw(&out, symtab[i].text, strlen(symtab[i].text) + 1);
+		}
+	}
+	outw(&out, pad, ((h.nstr + 3) & ~3) - h.nstr);
+}
+
 void
 dumpgates(int haltstate)
 {
 	register int i, j, k, maxlevel = 0;
 
+	/* Even a design without gates has constants 0 and 1 */
+	if (gatesp == 0) initgates();
+
 	/* Mark which gates are really used by assignments */
 	for (i=0; i<MAXV; ++i) {
 		if (symtab[i].type == WORD) {
-			forbus (j) recurmark(symtab[i].bus.wire[j]);
+			forbus (j) recurmark(symtab[i].bus[j]);
 		}
 	}
 
@@ -487,15 +1523,29 @@ dumpgates(int haltstate)
 		}
 	}
 
+	/* What the adders chosen by -a cost, to compare them;
+	   on stderr, so the netlist output is the same
+	*/
+	if (adder != ADDQUIET) {
+		static char *name[] = { "ripple", "Kogge-Stone", "Brent-Kung", "Han-Carlson" };
+		fprintf(stderr, "%s adders: %d gates, depth %d\n",
+			name[adder], gatesneed, maxlevel);
+	}
+
 	/* Output gate assignments? */
 	if (outtyp & OUTGATE) {
-		//printf("TEST!!!!!");
 		/* Output the logic formula for each gate */
 		for (i=2; i<gatesp; ++i) {
-			//printf("TEST2!!!!!");
 			if (gate[i].needed) {
-				printf("G%u = %s(%s, ", gate[i].newno, gatefunc(gate[i].op), gatename(gate[i].arg0));
-				printf("%s)\n", gatename(gate[i].arg1));
+				outc(&out, 'G');
+				outu(&out, gate[i].newno);
+				outs(&out, " = ");
+				outs(&out, gatefunc(gate[i].op));
+				outc(&out, '(');
+				gatename(&out, gate[i].arg0);
+				outs(&out, ", ");
+				gatename(&out, gate[i].arg1);
+				outs(&out, ")\n");
 			}
 		}
 
@@ -504,134 +1554,147 @@ dumpgates(int haltstate)
 			if (symtab[i].type == WORD) {
 				forbus (j) {
 					/* Any variable bit that changed value */
-					if (symtab[i].bus.wire[j] != (VARPTR2NUM(&(symtab[i])) + j)) {
-						printf("_%s = ", gatename((i * VARBIAS) + j));
-						printf("%s\n", gatename(symtab[i].bus.wire[j]));
+					if (symtab[i].bus[j] != (VARPTR2NUM(&(symtab[i])) + j)) {
+						outc(&out, '_');
+						gatename(&out, VARPTR2NUM(&(symtab[i])) + j);
+						outs(&out, " = ");
+						gatename(&out, symtab[i].bus[j]);
+						outc(&out, '\n');
 					}
 				}
 			}
 		}
 
-		printf("\n\n");
+		outs(&out, "\n\n");
 	}
 
 	/* Output verilog code? */
 	if (outtyp & OUTVER) {
-		printf("module statemachine(halt, clk);\n"
-		       "output halt;\n"
-		       "input clk;\n");
+		outs(&out, "module statemachine(halt, clk);\n"
+		     "output halt;\n"
+		     "input clk;\n");
 
 		/* Define all variables */
 		for (i=0; i<MAXV; ++i) {
 			if (symtab[i].type == WORD) {
-				var *p = NUM2VARPTR(i * VARBIAS);
-
-				printf("reg [%d:0] %s_%d_%d%s;\n",
-				       ((BUSWIDTH * p->dim) - 1),
-				       p->text,
-				       p->deflev,
-				       p->defblk,
-				       ((p == statevar) ? " = 0" : ""));
+				var *p = &(symtab[i]);
+
+				outf(&out, "reg [%d:0] %s_%d_%d%s;\n",
+				     ((BUSWIDTH * p->dim) - 1),
+				     p->text,
+				     p->deflev,
+				     p->defblk,
+				     ((p == statevar) ? " = 0" : ""));
 			}
 		}
-		printf("wire [%d:0] w;\n\n", gatesneed-3);
+		outf(&out, "wire [%d:0] w;\n\n", gatesneed-3);
 
 		/* Output the assignments */
 		for (i=2; i<gatesp; ++i) {
 			if (gate[i].needed) {
-				/* Note: vname uses a static buffer,
-				   so need two printfs below
-				*/
-				printf("%s(w[%u], %s, ",
-				       gatefunc(gate[i].op),
-				       gate[i].newno-2,
-				       vname(gate[i].arg0));
-				printf("%s);\n",
-				       vname(gate[i].arg1));
+				outs(&out, gatefunc(gate[i].op));
+				outs(&out, "(w[");
+				outu(&out, gate[i].newno-2);
+				outs(&out, "], ");
+				vname(&out, gate[i].arg0);
+				outs(&out, ", ");
+				vname(&out, gate[i].arg1);
+				outs(&out, ");\n");
 			}
 		}
-		printf("assign halt = (STATE_0_0 == %u);\n", haltstate);
+		outf(&out, "assign halt = (STATE_0_0 == %u);\n", haltstate);
 
 		/* Spit-out clocked updates */
-		printf("always @(posedge clk) if (!halt) begin\n");
+		outs(&out, "always @(posedge clk) if (!halt) begin\n");
 		for (i=0; i<MAXV; ++i) {
 			if (symtab[i].type == WORD) {
 				forbus (j) {
 					/* Any variable bit that changed value */
-					if (symtab[i].bus.wire[j] != (VARPTR2NUM(&(symtab[i])) + j)) {
-						printf("\t%s <= ", vname((i * VARBIAS) + j));
-						printf("%s;\n", vname(symtab[i].bus.wire[j]));
+					if (symtab[i].bus[j] != (VARPTR2NUM(&(symtab[i])) + j)) {
+						outc(&out, '\t');
+						vname(&out, VARPTR2NUM(&(symtab[i])) + j);
+						outs(&out, " <= ");
+						vname(&out, symtab[i].bus[j]);
+						outs(&out, ";\n");
 					}
 				}
 			}
 		}
-		printf("end\n"
-		       "endmodule\n"
-		       "\n"
-		       "module testbench;\n"
-		       "wire halt;\n"
-		       "reg clk = 0;\n"
-		       "statemachine m(halt, clk);\n"
-		       "initial begin\n"
-		       "\t$dumpfile;\n"
-		       "\t$dumpvars(1");
+		outs(&out, "end\n"
+		     "endmodule\n"
+		     "\n"
+		     "module testbench;\n"
+		     "wire halt;\n"
+		     "reg clk = 0;\n"
+		     "statemachine m(halt, clk);\n"
+		     "initial begin\n"
+		     "\t$dumpfile;\n"
+		     "\t$dumpvars(1");
 
 		/* Dump all variables */
 		for (i=0; i<MAXV; ++i) {
 			if (symtab[i].type == WORD) {
-				var *p = NUM2VARPTR(i * VARBIAS);
+				var *p = &(symtab[i]);
 
-				printf(",\nm.%s_%d_%d", p->text, p->deflev, p->defblk);
+				outf(&out, ",\nm.%s_%d_%d", p->text, p->deflev, p->defblk);
 			}
 		}
-		printf(");\n"
-		       "\twhile (!halt) begin\n"
-		       "\t\t#1 clk <= !clk;\n"
-		       "\tend\n"
-		       "\t$finish;\n"
-		       "end\n"
-		       "endmodule\n");
+		outs(&out, ");\n"
+		     "\twhile (!halt) begin\n"
+		     "\t\t#1 clk <= !clk;\n"
+		     "\tend\n"
+		     "\t$finish;\n"
+		     "end\n"
+		     "endmodule\n");
 	}
 
 	/* Output dot file? */
 	if (outtyp & OUTDOT) {
-		printf("digraph gates {\n"
-		       "ordering=out;\n"
-		       "clusterrank=global;\n"
-		       "size=\"6,4\";\n"
-		       "ratio=fill;\n"
-		       "remincross=true;\n"
-		       "rankdir=LR;\n"
-		       "style=\"invis\";\n"
-		       "node [fontname=Helvetica];\n");
+		/* Color of each level, formatted once */
+		char (*hue)[16] = ((char (*)[16]) malloc((maxlevel + 2) * sizeof(*hue)));
+
+		if (hue == 0) {
+			error("out of memory for dot output");
+			exit(1);
+		}
+		for (k=0; k<=(maxlevel+1); ++k) sprintf(hue[k], "%f", (k / (maxlevel+2.0)));
+
+		outs(&out, "digraph gates {\n"
+		     "ordering=out;\n"
+		     "clusterrank=global;\n"
+		     "size=\"6,4\";\n"
+		     "ratio=fill;\n"
+		     "remincross=true;\n"
+		     "rankdir=LR;\n"
+		     "style=\"invis\";\n"
+		     "node [fontname=Helvetica];\n");
 
 		/* Spit-out input definitions */
-		printf("node [color=\"%f,1.0,1.0\"];\n"
-		       "subgraph cluster_%d { rank=same;\n",
-		       0.0, 0);
-		printf("%s [label=\"", gatename(0));
-		printf("%s\"];\n", gatename(0));
-		printf("%s [label=\"", gatename(1));
-		printf("%s\"];\n", gatename(1));
+		outf(&out, "node [color=\"%s,1.0,1.0\"];\n"
+		     "subgraph cluster_%d { rank=same;\n",
+		     hue[0], 0);
+		dotnode(&out, 0, "");
+		dotnode(&out, 1, "");
 		for (i=0; i<MAXV; ++i) {
 			if (symtab[i].type == WORD) {
-				forbus (j) {
-					printf("%s [label=\"", gatename((i * VARBIAS) + j));
-					printf("%s\"];\n", gatename((i * VARBIAS) + j));
-				}
+				forbus (j) dotnode(&out, VARPTR2NUM(&(symtab[i])) + j, "");
 			}
 		}
-		printf("}\n");
+		outs(&out, "}\n");
 
 		/* Output the gates as same-rank nodes */
 		for (k=1; k<=(maxlevel+1); ++k) {
-			printf("node [color=\"%f,1.0,1.0\"];\n"
-			       "subgraph cluster_%d { rank=same;\n",
-			       (k / (maxlevel+2.0)),
-			       k);
+			outf(&out, "node [color=\"%s,1.0,1.0\"];\n"
+			     "subgraph cluster_%d { rank=same;\n",
+			     hue[k],
+			     k);
 			for (i=2; i<gatesp; ++i) {
 				if (gate[i].needed && (gate[i].level == k)) {
-					printf("G%u [label=\"%s\"];\n", gate[i].newno, gatefunc(gate[i].op));
+					outc(&out, 'G');
+					outu(&out, gate[i].newno);
+					outs(&out, " [label=\"");
+					outs(&out, gatefunc(gate[i].op));
+					outs(&out, "\"];\n");
 				}
 			}
 
@@ -639,8 +1702,8 @@ dumpgates(int haltstate)
 				if (symtab[i].type == WORD) {
 					forbus (j) {
 						/* Any variable bit that changed value */
-						if (symtab[i].bus.wire[j] != (VARPTR2NUM(&(symtab[i])) + j)) {
-							register int lev = symtab[i].bus.wire[j];
+						if (symtab[i].bus[j] != (VARPTR2NUM(&(symtab[i])) + j)) {
+							register int lev = symtab[i].bus[j];
 
 							if ((lev < 2) || (lev >= VARBIAS)) {
 								lev = 1;
@@ -649,32 +1712,30 @@ dumpgates(int haltstate)
 							}
 
 							if (lev == k) {
-								printf("_%s [label=\"", gatename((i * VARBIAS) + j));
-								printf("_%s\"];\n", gatename((i * VARBIAS) + j));
+								dotnode(&out, VARPTR2NUM(&(symtab[i])) + j, "_");
 							}
 						}
 					}
 				}
 			}
 
-			printf("}\n");
+			outs(&out, "}\n");
 		}
 
 		/* Spit-out needed output definitions */
-		printf("{\n"
-		       "rank = same;\n");
+		outs(&out, "{\n"
+		     "rank = same;\n");
 		for (i=0; i<MAXV; ++i) {
 			if (symtab[i].type == WORD) {
 				forbus (j) {
 					/* Any variable bit that changed value */
-					if (symtab[i].bus.wire[j] != (VARPTR2NUM(&(symtab[i])) + j)) {
-						printf("_%s [label=\"", gatename((i * VARBIAS) + j));
-						printf("_%s\"];\n", gatename((i * VARBIAS) + j));
+					if (symtab[i].bus[j] != (VARPTR2NUM(&(symtab[i])) + j)) {
+						dotnode(&out, VARPTR2NUM(&(symtab[i])) + j, "_");
 					}
 				}
 			}
 		}
-		printf("}\n");
+		outs(&out, "}\n");
 
 		/* Output the wires to each gate */
 		for (i=2; i<gatesp; ++i) {
@@ -683,15 +1744,17 @@ dumpgates(int haltstate)
 
 				k = gate[i].arg0;
 				if (k >= VARBIAS) k = 0; else k = gate[k].level;
-				printf("%s -> G%u ", gatename(gate[i].arg0), gate[i].newno);
-				printf("[color=\"%f,1.0,1.0\"];\n",
-				       (k / (maxlevel+2.0)));
+				gatename(&out, gate[i].arg0);
+				outs(&out, " -> G");
+				outu(&out, gate[i].newno);
+				dotedge(&out, hue[k]);
 
 				k = gate[i].arg1;
 				if (k >= VARBIAS) k = 0; else k = gate[k].level;
-				printf("%s -> G%u ", gatename(gate[i].arg1), gate[i].newno);
-				printf("[color=\"%f,1.0,1.0\"];\n",
-				       (k / (maxlevel+2.0)));
+				gatename(&out, gate[i].arg1);
+				outs(&out, " -> G");
+				outu(&out, gate[i].newno);
+				dotedge(&out, hue[k]);
 			}
 		}
 
@@ -700,19 +1763,29 @@ dumpgates(int haltstate)
 			if (symtab[i].type == WORD) {
 				forbus (j) {
 					/* Any variable bit that changed value */
-					if (symtab[i].bus.wire[j] != (VARPTR2NUM(&(symtab[i])) + j)) {
+					if (symtab[i].bus[j] != (VARPTR2NUM(&(symtab[i])) + j)) {
 						/* Arc color matches source */
-						k = symtab[i].bus.wire[j];
+						k = symtab[i].bus[j];
 						if (k >= VARBIAS) k = 0; else k = gate[k].level;
-						printf("%s -> ", gatename(symtab[i].bus.wire[j]));
-						printf("_%s ", gatename((i * VARBIAS) + j));
-						printf("[color=\"%f,1.0,1.0\"];\n",
-						       (k / (maxlevel+2.0)));
+						gatename(&out, symtab[i].bus[j]);
+						outs(&out, " -> _");
+						gatename(&out, VARPTR2NUM(&(symtab[i])) + j);
+						dotedge(&out, hue[k]);
 					}
 				}
 			}
 		}
 
-		printf("}\n");
+		outs(&out, "}\n");
+		free(hue);
 	}
+
+	/* Binary netlist? */
+	if (outtyp & OUTBIN) dumpbin(haltstate, maxlevel);
+
+	/* Output C evaluator? */
+	if (outtyp & OUTEVAL) dumpeval(haltstate, maxlevel);
+
+	/* Simulate it? */
+	if (outtyp & OUTSIM) simgates(haltstate, maxlevel);
 }
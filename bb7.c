@@ -0,0 +1,145 @@
+/*	bb7.c
+
+	Basic Block compiler in C:  Machine Model
+
+	Text model for the VLIW scheduler, one directive per line,
+	# to end of line is a comment:
+
+		width 4		issue slots per cycle
+		unit fetch 1 4	unit class, how many, slots busy per op
+		op ldx 4 fetch	opcode, slots until the result can
+				be used, and optionally its unit
+
+	Opcodes not named take 1 slot and need no unit.
+*/
+
+#include	"bb.h"
+
+machine_t	machine;	/* width 0 until someone sets it */
+
+static struct {
+	char	*name;
+	opcode	op;
+} opnames[] = {
+	{ "add", ADD },
+	{ "sub", SUB },
+	{ "and", AND },
+	{ "or", OR },
+	{ "xor", XOR },
+	{ "gt", GT },
+	{ "ge", GE },
+	{ "eq", EQ },
+	{ "ssl", SSL },
+	{ "ssr", SSR },
+	{ "mul", MUL },
+	{ "const", CONST },
+	{ "ld", LD },
+	{ "ldx", LDX },
+	{ "st", ST },
+	{ "stx", STX },
+	{ 0, 0 }
+};
+
+void
+machinit(int width)
+{
+	/* Start a model: every op 1 slot, no units */
+	register int i;
+
+	machine.width = width;
+	machine.nunits = 0;
+	for (i=0; i<NOPCODES; ++i) {
+		machine.lat[i] = 1;
+		machine.use[i] = -1;
+	}
+}
+
+int
+machunit(char *name, int count, int busy)
+{
+	/* Add (or redefine) a unit class, return its number */
+	register int u;
+
+	for (u=0; u<machine.nunits; ++u) {
+		if (strcmp(machine.unit[u].name, name) == 0) break;
+	}
+	if (u >= MAXUNITS) return(-1);
+	if (u == machine.nunits) ++machine.nunits;
+	strncpy(machine.unit[u].name, name, sizeof(machine.unit[u].name) - 1);
+	machine.unit[u].count = count;
+	machine.unit[u].busy = busy;
+	return(u);
+}
+
+void
+machop(opcode op, int lat, int unit)
+{
+	machine.lat[op] = lat;
+	machine.use[op] = unit;
+}
+
+static void
+machbad(char *file, int line, char *why)
+{
+	fprintf(stderr, "%s, line %d: %s\n", file, line, why);
+	exit(1);
+}
+
+void
+readmachine(char *file)
+{
+	/* Read a model, replacing the built-in one */
+	register FILE *fp;
+	register int i;
+	char buf[256], word[64], name[64], unit[64];
+	int line = 0, a, b, n;
+
+	if ((fp = fopen(file, "r")) == 0) {
+		perror(file);
+		exit(1);
+	}
+
+	machinit(4);
+	while (fgets(buf, sizeof(buf), fp)) {
+		register char *p;
+
+		++line;
+		if ((p = strchr(buf, '#')) != 0) *p = 0;
+		if (sscanf(buf, "%63s", word) != 1) continue;
+
+		if (strcmp(word, "width") == 0) {
+			if ((sscanf(buf, "%*s %d", &a) != 1) || (a < 1)) {
+				machbad(file, line, "width needs a count of at least 1");
+			}
+			machine.width = a;
+		} else if (strcmp(word, "unit") == 0) {
+			if ((sscanf(buf, "%*s %63s %d %d", name, &a, &b) != 3) ||
+			    (a < 1) || (a > MAXUNITN) || (b < 1)) {
+				machbad(file, line, "unit needs a name, 1 to 16 of them, and busy slots");
+			}
+			if (machunit(name, a, b) < 0) {
+				machbad(file, line, "too many unit classes");
+			}
+		} else if (strcmp(word, "op") == 0) {
+			n = sscanf(buf, "%*s %63s %d %63s", name, &a, unit);
+			if ((n < 2) || (a < 1)) {
+				machbad(file, line, "op needs an opcode and a latency of at least 1");
+			}
+			for (i=0; opnames[i].name; ++i) {
+				if (strcmp(opnames[i].name, name) == 0) break;
+			}
+			if (opnames[i].name == 0) machbad(file, line, "unknown opcode");
+			b = -1;
+			if (n == 3) {
+				for (b=0; b<machine.nunits; ++b) {
+					if (strcmp(machine.unit[b].name, unit) == 0) break;
+				}
+				if (b >= machine.nunits) machbad(file, line, "unit not defined yet");
+			}
+			machop(opnames[i].op, a, b);
+		} else {
+			machbad(file, line, "expected width, unit, or op");
+		}
+	}
+	fclose(fp);
+}
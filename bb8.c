@@ -0,0 +1,141 @@
+/*	bb8.c
+
+	Basic Block compiler in C:  Work Pool
+
+	Runs independent jobs 0 to n-1 on up to jobs threads.  Each
+	thread starts on a run of consecutive jobs costing about the
+	same as the others' and takes them from the front; a thread
+	whose run is empty steals the back half of the fullest run
+	left, so no thread idles while another has a backlog.  The
+	calling thread is one of the workers, so the jobs all get
+	done even if no other thread can be started.
+*/
+
+#include	"bb.h"
+#include	<pthread.h>
+
+typedef struct {
+	pthread_mutex_t	lock;
+	int	lo, hi;		/* jobs lo to hi-1 are left */
+	pthread_t	tid;
+	int	started;	/* tid is a running thread */
+} run_t;
+
+static	run_t	*runs;
+static	int	nruns;
+static	void	(*runjob)(int, int);
+static	void	(*rundone)(void);
+
+static int
+left(register run_t *r)
+{
+	/* Jobs left in run r */
+	register int n;
+
+	pthread_mutex_lock(&(r->lock));
+	n = r->hi - r->lo;
+	pthread_mutex_unlock(&(r->lock));
+	return(n);
+}
+
+static int
+steal(register run_t *r)
+{
+	/* Refill the empty run r from the fullest other run;
+	   returns 0 if there was nothing left anywhere
+	*/
+	register run_t *v;
+	register int i, k, most, lo, hi;
+
+	for (;;) {
+		for (i=0, v=0, most=0; i<nruns; ++i) {
+			if ((&(runs[i]) != r) && ((k = left(&(runs[i]))) > most)) {
+				most = k;
+				v = &(runs[i]);
+			}
+		}
+		if (v == 0) return(0);
+
+		/* It may have shrunk since; take what half is there */
+		pthread_mutex_lock(&(v->lock));
+		lo = v->hi - ((v->hi - v->lo + 1) / 2);
+		hi = v->hi;
+		v->hi = lo;
+		pthread_mutex_unlock(&(v->lock));
+		if (lo < hi) break;
+	}
+	pthread_mutex_lock(&(r->lock));
+	r->lo = lo;
+	r->hi = hi;
+	pthread_mutex_unlock(&(r->lock));
+	return(1);
+}
+
+static void *
+worker(void *arg)
+{
+	/* Run jobs until there are none left anywhere */
+	register run_t *r = ((run_t *) arg);
+	register int j;
+
+	for (;;) {
+		pthread_mutex_lock(&(r->lock));
+		j = ((r->lo < r->hi) ? (r->lo)++ : -1);
+		pthread_mutex_unlock(&(r->lock));
+		if (j >= 0) {
+			(*runjob)(j, (r - runs));
+		} else if (!steal(r)) {
+			break;
+		}
+	}
+	if (rundone) (*rundone)();
+	return(0);
+}
+
+int
+workpool(int n, int *cost, void (*job)(int, int), void (*done)(void))
+{
+	/* Run job(0, w) to job(n-1, w), cost[i] being a guess at how
+	   long job i takes and w which thread (0 up to the number
+	   returned) runs it; each thread calls done(), if any, at the end
+	*/
+	register int i, t;
+	double total = 0, sofar = 0;
+
+	nruns = ((jobs < n) ? jobs : n);
+	if (nruns < 1) nruns = 1;
+	runjob = job;
+	rundone = done;
+	runs = ((run_t *) malloc(nruns * sizeof(run_t)));
+	if (runs == 0) {
+		error("out of memory for work pool");
+		exit(1);
+	}
+
+	/* Cut the jobs into runs of about equal cost */
+	for (i=0; i<n; ++i) total += (cost[i] + 1);
+	for (t=0, i=0; t<nruns; ++t) {
+		pthread_mutex_init(&(runs[t].lock), 0);
+		runs[t].lo = i;
+		while ((i < n) &&
+		       ((t == (nruns - 1)) ||
+			((sofar + cost[i] + 1) <= ((total * (t + 1)) / nruns)) ||
+			(i == runs[t].lo))) {
+			sofar += (cost[i++] + 1);
+		}
+		runs[t].hi = i;
+		runs[t].started = 0;
+	}
+
+	/* This thread works the first run */
+	for (t=1; t<nruns; ++t) {
+		runs[t].started = !pthread_create(&(runs[t].tid), 0, worker, &(runs[t]));
+	}
+	worker(&(runs[0]));
+	for (t=1; t<nruns; ++t) {
+		if (runs[t].started) pthread_join(runs[t].tid, 0);
+	}
+	for (t=0; t<nruns; ++t) pthread_mutex_destroy(&(runs[t].lock));
+	free(runs);
+	return(nruns);
+}
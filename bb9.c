@@ -0,0 +1,121 @@
+/*	bb9.c
+
+	Basic Block compiler in C:  Output Buffers
+
+	Listings and netlists are built up in large buffers that are
+	written out with one fwrite() per buffer-full, and numbers
+	are converted here instead of by printf.  An out_t with no
+	file just keeps growing, holding text to be printed later.
+*/
+
+#include	"bb.h"
+#include	<stdarg.h>
+
+#define	OUTCHUNK	(256 * 1024)	/* initial buffer size */
+
+out_t	out;		/* stdout, once main() sets it up */
+
+void
+outinit(register out_t *o, FILE *f)
+{
+	/* Empty buffer for f, or kept in memory if f is 0 */
+	o->buf = 0;
+	o->n = (o->max = 0);
+	o->f = f;
+}
+
+void
+outflush(register out_t *o)
+{
+	/* Write out what is buffered */
+	if (o->f && (o->n > 0)) {
+		fwrite(o->buf, 1, o->n, o->f);
+		o->n = 0;
+	}
+}
+
+void
+outfree(register out_t *o)
+{
+	/* Flush and give back the buffer */
+	outflush(o);
+	free(o->buf);
+	outinit(o, o->f);
+}
+
+void
+outroom(register out_t *o, register int k)
+{
+	/* Make room for k more characters */
+	if ((o->n + k) <= o->max) return;
+	outflush(o);
+	if ((o->n + k) <= o->max) return;
+	if (o->max == 0) o->max = OUTCHUNK;
+	while ((o->n + k) > o->max) o->max *= 2;
+	if ((o->buf = ((char *) realloc(o->buf, o->max))) == 0) {
+		error("out of memory for output buffer");
+		exit(1);
+	}
+}
+
+void
+outw(register out_t *o, register char *s, register int n)
+{
+	/* n characters from s */
+	outroom(o, n);
+	memcpy(o->buf + o->n, s, n);
+	o->n += n;
+}
+
+void
+outs(register out_t *o, register char *s)
+{
+	/* A string */
+	outw(o, s, strlen(s));
+}
+
+void
+outu(register out_t *o, register unsigned long long u)
+{
+	/* An unsigned decimal */
+	char d[24];
+	register char *p = &(d[24]);
+
+	do {
+		*(--p) = ('0' + (u % 10));
+		u /= 10;
+	} while (u);
+	outw(o, p, (&(d[24]) - p));
+}
+
+void
+outd(register out_t *o, register long long i)
+{
+	/* A signed decimal */
+	if (i < 0) {
+		outc(o, '-');
+		outu(o, -((unsigned long long) i));
+	} else {
+		outu(o, i);
+	}
+}
+
+void
+outf(register out_t *o, char *fmat, ...)
+{
+	/* printf, for the odd line not worth doing by hand */
+	va_list ap;
+	register int n;
+
+	outroom(o, 256);
+	va_start(ap, fmat);
+	n = vsnprintf(o->buf + o->n, o->max - o->n, fmat, ap);
+	va_end(ap);
+	if (n >= (o->max - o->n)) {
+		outroom(o, n + 1);
+		va_start(ap, fmat);
+		vsnprintf(o->buf + o->n, o->max - o->n, fmat, ap);
+		va_end(ap);
+	}
+	o->n += n;
+}
@@ -0,0 +1,123 @@
+/*	bbnet.c
+
+	Basic Block compiler in C:  Binary Netlist Reader
+
+	Maps a bbgates -b netlist read-only and checks that every
+	count, offset and wire number stays inside the file, so the
+	caller can walk the arrays without checking anything.
+*/
+
+#include	<errno.h>
+#include	<fcntl.h>
+#include	<string.h>
+#include	<sys/mman.h>
+#include	<sys/stat.h>
+#include	<unistd.h>
+#include	"bbnet.h"
+
+static int
+inside(register const bbnet_head_t *h, register unsigned int off,
+register unsigned int n, register unsigned int size)
+{
+	/* Do n things of size bytes at off fit, aligned? */
+	if ((off & 3) || (off > h->size)) return(0);
+	if (size && (n > ((h->size - off) / size))) return(0);
+	return(1);
+}
+
+static int
+check(register bbnet_t *n)
+{
+	/* Is the mapped netlist sane? */
+	register const bbnet_head_t *h = n->head;
+	register unsigned int i, wires;
+
+	if ((n->size < sizeof(bbnet_head_t)) ||
+	    (h->magic != BBNET_MAGIC) ||
+	    (h->version != BBNET_VERSION) ||
+	    (h->size != n->size)) return(0);
+	if (!inside(h, h->gates, h->ngates, sizeof(bbnet_gate_t)) ||
+	    !inside(h, h->vars, h->nvars, sizeof(bbnet_var_t)) ||
+	    !inside(h, h->outs, h->nouts, sizeof(bbnet_out_t)) ||
+	    (h->strs > h->size) || (h->nstr > (h->size - h->strs))) return(0);
+	if ((h->ngates < 2) || (h->nvars && (h->state >= h->nvars))) return(0);
+	if ((h->buswidth < 1) || (h->buswidth > BBNET_MAXWIDTH)) return(0);
+	if (h->nbits > (0xffffffffU - h->ngates)) return(0);
+	wires = h->ngates + h->nbits;
+
+	n->gates = ((const bbnet_gate_t *) (((const char *) n->map) + h->gates));
+	n->vars = ((const bbnet_var_t *) (((const char *) n->map) + h->vars));
+	n->outs = ((const bbnet_out_t *) (((const char *) n->map) + h->outs));
+	n->strs = (((const char *) n->map) + h->strs);
+
+	/* Strings end in a NUL, so every name does */
+	if (h->nvars && ((h->nstr == 0) || n->strs[h->nstr - 1])) return(0);
+
+	/* Gates only use wires before them or register bits */
+	for (i=2; i<h->ngates; ++i) {
+		register const bbnet_gate_t *g = &(n->gates[i]);
+
+		if ((g->op < BBNET_AND) || (g->op > BBNET_NOR)) return(0);
+		if ((g->arg0 >= wires) || (g->arg1 >= wires)) return(0);
+		if (((g->arg0 >= i) && (g->arg0 < h->ngates)) ||
+		    ((g->arg1 >= i) && (g->arg1 < h->ngates))) return(0);
+	}
+	for (i=0; i<h->nvars; ++i) {
+		register const bbnet_var_t *v = &(n->vars[i]);
+
+		if ((v->name >= h->nstr) ||
+		    (v->base < h->ngates) || (v->base > wires) ||
+		    (((unsigned long long) v->dim) * h->buswidth > (wires - v->base))) return(0);
+	}
+	for (i=0; i<h->nouts; ++i) {
+		if ((n->outs[i].reg < h->ngates) || (n->outs[i].reg >= wires) ||
+		    (n->outs[i].wire >= wires)) return(0);
+	}
+	return(1);
+}
+
+int
+bbnet_open(register bbnet_t *n, const char *file)
+{
+	/* Map and check the netlist in file */
+	struct stat st;
+	register int fd, e;
+
+	memset(n, 0, sizeof(*n));
+	if ((fd = open(file, O_RDONLY)) < 0) return(-1);
+	if (fstat(fd, &st) < 0) {
+		e = errno;
+		close(fd);
+		errno = e;
+		return(-1);
+	}
+	n->size = st.st_size;
+	if (n->size < sizeof(bbnet_head_t)) {
+		close(fd);
+		errno = EINVAL;
+		return(-1);
+	}
+	n->map = mmap(0, n->size, PROT_READ, MAP_PRIVATE, fd, 0);
+	e = errno;
+	close(fd);
+	if (n->map == MAP_FAILED) {
+		n->map = 0;
+		errno = e;
+		return(-1);
+	}
+	n->head = ((const bbnet_head_t *) n->map);
+	if (!check(n)) {
+		bbnet_close(n);
+		errno = EINVAL;
+		return(-1);
+	}
+	return(0);
+}
+
+void
+bbnet_close(register bbnet_t *n)
+{
+	/* Unmap it */
+	if (n->map) munmap(n->map, n->size);
+	memset(n, 0, sizeof(*n));
+}
@@ -0,0 +1,95 @@
+/*	bbnet.h
+
+	Basic Block compiler in C:  Binary Netlist (-b)
+
+	What bbgates -b writes, and the reader in bbnet.c, which maps
+	a netlist file and hands back pointers into it, so nothing
+	is parsed or copied.  Everything is 32-bit words in the byte
+	order of the machine that wrote it; a reader on the other
+	byte order sees a bad magic number.  The file is:
+
+		header		bbnet_head_t
+		gates		ngates bbnet_gate_t, in dumpgates() newno order
+		vars		nvars bbnet_var_t
+		outputs		nouts bbnet_out_t
+		strings		var names, NUL terminated
+
+	Wires 0 to ngates-1 are gate outputs (0 and 1 being the
+	constants 0 and 1); wires ngates up are register bits, each
+	var's bits starting at its base.  Each clock, every output's
+	register bit loads the value of its wire; bits without an
+	output keep their value.  The design halts once the state
+	var's bits hold haltstate.
+*/
+
+#ifndef	BBNET_H
+#define	BBNET_H
+
+#include	<stddef.h>
+
+#define	BBNET_MAGIC	0x4c4e4242	/* "BBNL" read as little-endian */
+#define	BBNET_VERSION	1
+#define	BBNET_MAXWIDTH	64	/* widest buswidth */
+
+/*	Gate ops */
+#define	BBNET_ZERO	0	/* constant 0 (wire 0) */
+#define	BBNET_ONE	1	/* constant 1 (wire 1) */
+#define	BBNET_AND	2
+#define	BBNET_OR	3
+#define	BBNET_XOR	4
+#define	BBNET_NAND	5
+#define	BBNET_NOR	6
+
+typedef struct {
+	unsigned int	magic;		/* BBNET_MAGIC */
+	unsigned int	version;	/* BBNET_VERSION */
+	unsigned int	size;		/* bytes in the file */
+	unsigned int	buswidth;	/* bits per word, 1 to BBNET_MAXWIDTH */
+	unsigned int	ngates;		/* gates, including the constants */
+	unsigned int	nbits;		/* register bits */
+	unsigned int	nvars;
+	unsigned int	nouts;
+	unsigned int	state;		/* var number of the state var */
+	unsigned int	haltstate;	/* state value that halts */
+	unsigned int	maxlevel;	/* deepest gate */
+	unsigned int	gates, vars, outs, strs;	/* byte offsets of each part */
+	unsigned int	nstr;		/* bytes of strings */
+} bbnet_head_t;
+
+typedef struct {
+	unsigned int	op;		/* BBNET_AND and so on */
+	unsigned int	arg0, arg1;	/* wires in */
+} bbnet_gate_t;
+
+typedef struct {
+	unsigned int	name;		/* offset of its name in the strings */
+	int	deflev, defblk;		/* scope it was declared in */
+	unsigned int	dim;		/* words, 1 if scalar */
+	unsigned int	base;		/* wire of its bit 0 */
+} bbnet_var_t;
+
+typedef struct {
+	unsigned int	reg;		/* register bit wire ... */
+	unsigned int	wire;		/* ... loads this each clock */
+} bbnet_out_t;
+
+typedef struct {
+	void	*map;			/* the mapped file */
+	size_t	size;
+	const bbnet_head_t	*head;
+	const bbnet_gate_t	*gates;
+	const bbnet_var_t	*vars;
+	const bbnet_out_t	*outs;
+	const char	*strs;
+} bbnet_t;
+
+/* Map and check the netlist in file; 0 if ok, else -1 with errno set */
+extern	int	bbnet_open(bbnet_t *n, const char *file);
+
+/* Unmap it */
+extern	void	bbnet_close(bbnet_t *n);
+
+/* Name of var v */
+#define	bbnet_name(N, V)	((N)->strs + (N)->vars[V].name)
+
+#endif
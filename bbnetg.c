@@ -0,0 +1,83 @@
+/*	bbnetg.c
+
+	Basic Block compiler in C:  Binary Netlist Lister
+
+	Maps a bbgates -b netlist through libbbnet.a and prints it
+	the way bbgates -g does, so make check can compare the two.
+	Exits 1 if the file will not open or is rejected.
+*/
+
+#include	<stdio.h>
+#include	<stdlib.h>
+#include	"bbnet.h"
+
+static	bbnet_t	net;
+static	unsigned int	*owner;	/* var of each register bit */
+
+static void
+wirename(register unsigned int w)
+{
+	/* Name of wire w, as gatename() in bb6.c */
+	register const bbnet_var_t *v;
+
+	if (w < 2) {
+		printf("_%u", w);
+	} else if (w < net.head->ngates) {
+		printf("G%u", w);
+	} else {
+		v = &(net.vars[owner[w - net.head->ngates]]);
+		printf("%s_%d_%d_%u",
+		       bbnet_name(&net, owner[w - net.head->ngates]),
+		       v->deflev,
+		       v->defblk,
+		       (w - v->base));
+	}
+}
+
+int
+main(int argc, char **argv)
+{
+	static char *func[] = { "", "", "and", "or", "xor", "nand", "nor" };
+	register const bbnet_head_t *h;
+	register unsigned int i, j;
+
+	if (argc != 2) {
+		fprintf(stderr, "Usage: %s netlist\n", argv[0]);
+		exit(1);
+	}
+	if (bbnet_open(&net, argv[1]) < 0) {
+		perror(argv[1]);
+		exit(1);
+	}
+	h = net.head;
+
+	/* Which var each register bit belongs to */
+	if ((owner = ((unsigned int *) calloc(h->nbits + 1, sizeof(unsigned int)))) == 0) {
+		fprintf(stderr, "out of memory for %u register bits\n", h->nbits);
+		exit(1);
+	}
+	for (i=0; i<h->nvars; ++i) {
+		for (j=0; j<(net.vars[i].dim * h->buswidth); ++j) {
+			owner[net.vars[i].base - h->ngates + j] = i;
+		}
+	}
+
+	for (i=2; i<h->ngates; ++i) {
+		printf("G%u = %s(", i, func[net.gates[i].op]);
+		wirename(net.gates[i].arg0);
+		printf(", ");
+		wirename(net.gates[i].arg1);
+		printf(")\n");
+	}
+	for (i=0; i<h->nouts; ++i) {
+		printf("_");
+		wirename(net.outs[i].reg);
+		printf(" = ");
+		wirename(net.outs[i].wire);
+		printf("\n");
+	}
+	printf("\n\n");
+
+	bbnet_close(&net);
+	exit(0);
+}
@@ -0,0 +1,71 @@
+0	lab(0)
+1	const(0)
+2	const(-1)
+3	ld(i{1,1})
+4	const(1)
+5	ssl(3, 4)
+6	st(i{1,1}, 5)
+7	st(j{1,1}, 1)
+8	st(k{1,1}, 1)
+9	st(l{1,1}, 5)
+10	st(m{1,1}, 5)
+11	st(n{1,1}, 2)
+12	st(o{1,1}, 1)
+13	st(p{1,1}, 1)
+14	st(q{1,1}, 2)
+15	st(r{1,1}, 1)
+16	lab(1)
+17	lab(2)
+18	const(0)
+19	const(-1)
+20	const(2)
+21	st(i{1,1}, 20)
+22	st(j{1,1}, 19)
+23	st(k{1,1}, 20)
+24	const(7)
+25	st(l{1,1}, 24)
+26	const(5)
+27	st(m{1,1}, 26)
+28	st(n{1,1}, 18)
+29	st(o{1,1}, 20)
+30	st(p{1,1}, 20)
+31	st(q{1,1}, 20)
+32	lab(3)
+33	lab(4)
+34	const(0)
+35	const(-1)
+36	const(1)
+37	st(a{1,1}, 36)
+38	stx(a{1,1}, 36, 35)
+39	st(b{1,1}, 34)
+40	st(i{1,1}, 34)
+41	st(j{1,1}, 34)
+42	const(2)
+43	stx(a{1,1}, 42, 34)
+44	st(l{1,1}, 34)
+45	st(m{1,1}, 34)
+46	const(3)
+47	stx(a{1,1}, 46, 36)
+48	st(n{1,1}, 35)
+49	lab(5)
+
+
+0	lab(0)
+0:	1	const(0)	2	const(-1)	4	const(1)	
+1:	3	ld(i{1,1})	7	st(j{1,1}, 1)	8	st(k{1,1}, 1)	11	st(n{1,1}, 2)
+2:	5	ssl(3, 4)	12	st(o{1,1}, 1)	13	st(p{1,1}, 1)	14	st(q{1,1}, 2)
+3:	6	st(i{1,1}, 5)	9	st(l{1,1}, 5)	10	st(m{1,1}, 5)	15	st(r{1,1}, 1)
+16	lab(1)
+17	lab(2)
+0:	18	const(0)	19	const(-1)	20	const(2)	24	const(7)
+1:	21	st(i{1,1}, 20)	22	st(j{1,1}, 19)	23	st(k{1,1}, 20)	25	st(l{1,1}, 24)
+2:	26	const(5)	28	st(n{1,1}, 18)	29	st(o{1,1}, 20)	30	st(p{1,1}, 20)
+3:	27	st(m{1,1}, 26)	31	st(q{1,1}, 20)	
+32	lab(3)
+33	lab(4)
+0:	34	const(0)	35	const(-1)	36	const(1)	42	const(2)
+1:	37	st(a{1,1}, 36)	39	st(b{1,1}, 34)	40	st(i{1,1}, 34)	41	st(j{1,1}, 34)
+2:	38	stx(a{1,1}, 36, 35)	44	st(l{1,1}, 34)	45	st(m{1,1}, 34)	46	const(3)
+3:	43	stx(a{1,1}, 42, 34)	48	st(n{1,1}, 35)	
+4:	47	stx(a{1,1}, 46, 36)	
+49	lab(5)
@@ -0,0 +1,126 @@
+0	lab(0)
+1	const(0)
+2	st(x{1,1}, 1)
+3	const(1)
+4	st(y{1,1}, 3)
+5	ld(n{1,1})
+6	const(15)
+7	and(6, 5)
+8	st(n{1,1}, 7)
+9	lab(1)
+10	const(0)
+11	ld(n{1,1})
+12	gt(11, 10)
+13	sel(12, 3, 2)
+14	lab(3)
+15	const(0)
+16	ld(n{1,1})
+17	const(1)
+18	sub(16, 17)
+19	st(n{1,1}, 18)
+20	ld(x{1,1})
+21	ld(y{1,1})
+22	add(21, 20)
+23	st(x{1,1}, 22)
+24	const(50)
+25	gt(22, 24)
+26	sel(25, 5, 6)
+27	lab(5)
+28	const(0)
+29	ld(y{1,1})
+30	const(5)
+31	xor(30, 29)
+32	st(y{1,1}, 31)
+33	sel(-1, 1, 1)
+34	lab(6)
+35	sel(-1, 4, 4)
+36	lab(4)
+37	const(0)
+38	ld(y{1,1})
+39	const(1)
+40	add(39, 38)
+41	st(y{1,1}, 40)
+42	ld(w{1,1})
+43	ld(x{1,1})
+44	xor(43, 42)
+45	st(w{1,1}, 44)
+46	sel(-1, 1, 1)
+47	lab(2)
+48	const(0)
+49	ld(z{1,1})
+50	const(4)
+51	eq(50, 49)
+52	sel(51, 8, 9)
+53	lab(8)
+54	const(0)
+55	const(5)
+56	st(z{1,1}, 55)
+57	sel(-1, 7, 7)
+58	lab(9)
+59	const(0)
+60	ld(z{1,1})
+61	ld(w{1,1})
+62	add(61, 60)
+63	st(z{1,1}, 62)
+64	sel(-1, 7, 7)
+65	lab(7)
+66	sel(-1, 12, 12)
+67	lab(11)
+68	lab(12)
+69	sel(-1, 10, 10)
+70	lab(10)
+71	lab(13)
+
+
+0	lab(0)
+0:	1	const(0)	3	const(1)	6	const(15)	
+1:	2	st(x{1,1}, 1)	4	st(y{1,1}, 3)	5	ld(n{1,1})	
+2:	7	and(6, 5)	
+3:	8	st(n{1,1}, 7)	
+9	lab(1)
+0:	10	const(0)	
+1:	11	ld(n{1,1})	
+2:	12	gt(11, 10)	
+13	sel(12, 3, 2)
+14	lab(3)
+0:	15	const(0)	17	const(1)	24	const(50)	
+1:	16	ld(n{1,1})	20	ld(x{1,1})	21	ld(y{1,1})	
+2:	18	sub(16, 17)	22	add(21, 20)	
+3:	19	st(n{1,1}, 18)	23	st(x{1,1}, 22)	25	gt(22, 24)	
+26	sel(25, 5, 6)
+27	lab(5)
+0:	28	const(0)	30	const(5)	
+1:	29	ld(y{1,1})	
+2:	31	xor(30, 29)	
+3:	32	st(y{1,1}, 31)	
+33	sel(-1, 1, 1)
+34	lab(6)
+35	sel(-1, 4, 4)
+36	lab(4)
+0:	37	const(0)	39	const(1)	
+1:	38	ld(y{1,1})	42	ld(w{1,1})	43	ld(x{1,1})	
+2:	40	add(39, 38)	44	xor(43, 42)	
+3:	41	st(y{1,1}, 40)	45	st(w{1,1}, 44)	
+46	sel(-1, 1, 1)
+47	lab(2)
+0:	48	const(0)	50	const(4)	
+1:	49	ld(z{1,1})	
+2:	51	eq(50, 49)	
+52	sel(51, 8, 9)
+53	lab(8)
+0:	54	const(0)	55	const(5)	
+1:	56	st(z{1,1}, 55)	
+57	sel(-1, 7, 7)
+58	lab(9)
+0:	59	const(0)	
+1:	60	ld(z{1,1})	61	ld(w{1,1})	
+2:	62	add(61, 60)	
+3:	63	st(z{1,1}, 62)	
+64	sel(-1, 7, 7)
+65	lab(7)
+66	sel(-1, 12, 12)
+67	lab(11)
+68	lab(12)
+69	sel(-1, 10, 10)
+70	lab(10)
+71	lab(13)
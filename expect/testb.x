@@ -0,0 +1,132 @@
+// initial
+lane	n_1_1	w_1_1	x_1_1	y_1_1	z_1_1	STATE_0_0
+0	0	0	0	0	0	0
+1	-58	-21	-28	76	89	0
+2	95	-10	-74	-5	22	0
+3	-15	-13	-3	57	39	0
+4	46	-12	-53	-19	89	0
+5	-65	-112	51	-5	-42	0
+6	-6	-112	-74	-94	31	0
+7	-47	-77	-95	-125	86	0
+8	37	-98	-106	-22	-11	0
+9	112	-115	109	-122	-99	0
+10	9	10	3	-91	-76	0
+11	57	14	46	27	-11	0
+12	-32	88	-86	-122	-67	0
+13	-26	5	-45	-114	-12	0
+14	-1	-127	-107	-114	36	0
+15	104	39	107	-28	-103	0
+16	57	-72	-90	124	116	0
+17	35	123	73	26	55	0
+18	-102	-103	-118	109	-39	0
+19	106	-28	73	-25	-4	0
+20	-91	-23	37	-73	-68	0
+21	-29	52	-83	111	-102	0
+22	-13	-49	-123	107	94	0
+23	-35	29	11	-34	-35	0
+24	21	82	23	31	50	0
+25	-21	104	-92	0	114	0
+26	108	-8	83	-59	-30	0
+27	-95	-42	125	125	-125	0
+28	-56	-19	99	-96	23	0
+29	28	-43	21	-39	115	0
+30	100	-86	31	95	63	0
+31	84	-75	-24	39	44	0
+32	6	-81	94	-108	-16	0
+33	-95	46	58	93	-107	0
+34	-23	13	122	112	-90	0
+35	-85	-12	43	114	-95	0
+36	6	-74	103	84	-67	0
+37	-109	-44	-89	-78	-33	0
+38	112	-34	120	30	-125	0
+39	55	119	94	14	-38	0
+40	-23	90	-84	7	-38	0
+41	23	1	50	116	-47	0
+42	63	45	25	105	-100	0
+43	-90	83	63	113	-12	0
+44	-79	-44	103	-108	-29	0
+45	-61	22	-115	-60	-95	0
+46	-57	-75	67	-39	-124	0
+47	70	106	35	55	-13	0
+48	29	104	56	82	-67	0
+49	-35	-93	-2	37	-33	0
+50	12	-66	-121	5	81	0
+51	-103	59	-5	-117	-90	0
+52	107	-76	109	-31	42	0
+53	-110	-35	-85	-64	110	0
+54	90	-124	28	64	-104	0
+55	-46	31	-88	-76	-38	0
+56	-92	-45	67	42	-51	0
+57	100	42	74	49	-75	0
+58	51	-69	117	-33	-83	0
+59	-43	111	100	-17	-15	0
+60	-19	81	61	52	-37	0
+61	30	72	39	88	-102	0
+62	-121	-111	20	-20	84	0
+63	-31	-61	-82	-124	-89	0
+// final
+lane	cycles	n_1_1	w_1_1	x_1_1	y_1_1	z_1_1	STATE_0_0
+0	7	0	0	0	1	0	13
+1	31	0	-1	21	7	88	13
+2	61	0	-9	120	10	13	13
+3	11	0	-14	1	2	25	13
+4	58	0	-11	105	15	78	13
+5	61	0	-111	120	10	103	13
+6	46	0	-111	55	15	-80	13
+7	11	0	-78	1	2	8	13
+8	27	0	-97	15	6	-108	13
+9	7	0	-115	0	1	42	13
+10	43	0	11	45	10	-65	13
+11	43	0	15	45	10	4	13
+12	7	0	88	0	1	21	13
+13	31	0	17	21	7	5	13
+14	61	0	-128	120	10	-92	13
+15	39	0	11	36	9	-92	13
+16	43	0	-71	45	10	45	13
+17	19	0	127	6	4	-74	13
+18	46	0	-104	55	15	113	13
+19	46	0	-27	55	15	-31	13
+20	27	0	-24	15	6	-92	13
+21	19	0	48	6	4	-54	13
+22	19	0	-53	6	4	41	13
+23	55	0	28	95	10	-7	13
+24	27	0	83	15	6	-123	13
+25	49	0	105	70	10	-37	13
+26	52	0	-7	80	15	-37	13
+27	11	0	-41	1	2	90	13
+28	39	0	-63	36	9	-40	13
+29	52	0	-44	80	15	71	13
+30	23	0	-92	10	5	-29	13
+31	23	0	-69	10	5	-25	13
+32	31	0	-69	21	7	-85	13
+33	11	0	47	1	2	-60	13
+34	43	0	12	45	10	-78	13
+35	49	0	-11	70	10	-106	13
+36	31	0	-94	21	7	95	13
+37	19	0	-48	6	4	-81	13
+38	7	0	-34	0	1	97	13
+39	35	0	127	28	8	89	13
+40	43	0	91	45	10	53	13
+41	35	0	9	28	8	-38	13
+42	61	0	44	120	10	-56	13
+43	31	0	71	21	7	59	13
+44	11	0	-43	1	2	-72	13
+45	19	0	18	6	4	-77	13
+46	35	0	-67	28	8	65	13
+47	31	0	126	21	7	113	13
+48	55	0	105	95	10	38	13
+49	55	0	-94	95	10	-127	13
+50	52	0	-65	80	15	16	13
+51	43	0	58	45	10	-32	13
+52	49	0	-75	70	10	-33	13
+53	15	0	-33	3	3	77	13
+54	46	0	-123	55	15	29	13
+55	15	0	29	3	3	-9	13
+56	23	0	-35	10	5	-86	13
+57	23	0	36	10	5	-39	13
+58	19	0	-65	6	4	108	13
+59	27	0	110	15	6	95	13
+60	55	0	80	95	10	43	13
+61	58	0	73	105	15	-29	13
+62	35	0	-103	28	8	-19	13
+63	11	0	-62	1	2	105	13
@@ -0,0 +1,105 @@
+0	lab(0)
+1	const(0)
+2	const(4)
+3	st(a{1,1}, 2)
+4	const(6)
+5	st(b{1,1}, 4)
+6	lab(1)
+7	const(0)
+8	ld(c{1,1})
+9	gt(8, 7)
+10	sel(9, 3, 2)
+11	lab(3)
+12	const(0)
+13	ld(c{1,1})
+14	const(4)
+15	sub(13, 14)
+16	st(c{1,1}, 15)
+17	ld(d{1,1})
+18	const(6)
+19	add(18, 17)
+20	st(d{1,1}, 19)
+21	sel(-1, 1, 1)
+22	lab(2)
+23	const(0)
+24	ld(d{1,1})
+25	const(6)
+26	gt(24, 25)
+27	sel(26, 5, 6)
+28	lab(5)
+29	const(0)
+30	const(10)
+31	st(d{1,1}, 30)
+32	sel(-1, 4, 4)
+33	lab(6)
+34	sel(-1, 4, 4)
+35	lab(4)
+36	const(0)
+37	const(6)
+38	const(14)
+39	st(c{1,1}, 38)
+40	ld(d{1,1})
+41	st(e{1,1}, 40)
+42	gt(40, 37)
+43	sel(42, 8, 9)
+44	lab(8)
+45	const(0)
+46	ld(d{1,1})
+47	const(4)
+48	sub(46, 47)
+49	st(f{1,1}, 48)
+50	sel(-1, 7, 7)
+51	lab(9)
+52	sel(-1, 7, 7)
+53	lab(7)
+54	const(0)
+55	ld(d{1,1})
+56	add(55, 55)
+57	st(g{1,1}, 56)
+58	lab(10)
+
+
+0	lab(0)
+0:	1	const(0)	2	const(4)	4	const(6)	
+1:	3	st(a{1,1}, 2)	5	st(b{1,1}, 4)	
+6	lab(1)
+0:	7	const(0)	
+1:	8	ld(c{1,1})	
+2:	9	gt(8, 7)	
+10	sel(9, 3, 2)
+11	lab(3)
+0:	12	const(0)	14	const(4)	18	const(6)	
+1:	13	ld(c{1,1})	17	ld(d{1,1})	
+2:	15	sub(13, 14)	19	add(18, 17)	
+3:	16	st(c{1,1}, 15)	20	st(d{1,1}, 19)	
+21	sel(-1, 1, 1)
+22	lab(2)
+0:	23	const(0)	25	const(6)	
+1:	24	ld(d{1,1})	
+2:	26	gt(24, 25)	
+27	sel(26, 5, 6)
+28	lab(5)
+0:	29	const(0)	30	const(10)	
+1:	31	st(d{1,1}, 30)	
+32	sel(-1, 4, 4)
+33	lab(6)
+34	sel(-1, 4, 4)
+35	lab(4)
+0:	36	const(0)	37	const(6)	38	const(14)	
+1:	39	st(c{1,1}, 38)	40	ld(d{1,1})	
+2:	41	st(e{1,1}, 40)	42	gt(40, 37)	
+43	sel(42, 8, 9)
+44	lab(8)
+0:	45	const(0)	47	const(4)	
+1:	46	ld(d{1,1})	
+2:	48	sub(46, 47)	
+3:	49	st(f{1,1}, 48)	
+50	sel(-1, 7, 7)
+51	lab(9)
+52	sel(-1, 7, 7)
+53	lab(7)
+0:	54	const(0)	
+1:	55	ld(d{1,1})	
+2:	56	add(55, 55)	
+3:	57	st(g{1,1}, 56)	
+58	lab(10)
@@ -0,0 +1,200 @@
+0000000 4c4e4242 00000001 00000c64 00000008
+0000016 000000e6 00000020 00000004 00000020
+0000032 00000003 00000004 0000001f 00000040
+0000048 00000b08 00000b58 00000c58 0000000c
+0000064 00000000 00000000 00000000 00000001
+0000080 00000001 00000001 00000005 00000001
+0000096 00000105 00000005 00000001 00000002
+0000112 00000005 00000002 00000105 00000005
+0000128 00000003 00000004 00000005 00000001
+0000144 00000104 00000005 00000001 00000006
+0000160 00000005 00000006 00000104 00000005
+0000176 00000007 00000008 00000005 00000005
+0000192 00000009 00000005 0000000a 0000000a
+0000208 00000005 00000001 00000103 00000005
+0000224 00000001 0000000c 00000005 0000000c
+0000240 00000103 00000005 0000000d 0000000e
+0000256 00000005 0000000b 0000000f 00000005
+0000272 00000010 00000010 00000005 00000001
+0000288 00000102 00000005 00000001 00000012
+0000304 00000005 00000012 00000102 00000005
+0000320 00000013 00000014 00000005 00000011
+0000336 00000015 00000005 00000016 00000016
+0000352 00000005 00000001 00000101 00000005
+0000368 00000001 00000018 00000005 00000018
+0000384 00000101 00000005 00000019 0000001a
+0000400 00000005 00000017 0000001b 00000005
+0000416 0000001c 0000001c 00000005 00000001
+0000432 00000100 00000005 00000001 0000001e
+0000448 00000005 0000001e 00000100 00000005
+0000464 0000001f 00000020 00000005 0000001d
+0000480 00000021 00000005 00000022 00000022
+0000496 00000005 00000001 000000ff 00000005
+0000512 00000001 00000024 00000005 00000024
+0000528 000000ff 00000005 00000025 00000026
+0000544 00000005 00000023 00000027 00000005
+0000560 00000028 00000028 00000005 00000001
+0000576 000000fe 00000005 00000001 0000002a
+0000592 00000005 0000002a 000000fe 00000005
+0000608 0000002b 0000002c 00000005 00000029
+0000624 0000002d 00000005 0000002e 0000002e
+0000640 00000005 0000002f 0000002f 00000005
+0000656 00000030 000000ee 00000005 00000001
+0000672 0000002f 00000005 00000031 00000032
+0000688 00000005 00000030 000000ef 00000005
+0000704 00000032 00000034 00000005 00000030
+0000720 000000f0 00000005 00000001 00000036
+0000736 00000005 00000030 000000f1 00000005
+0000752 00000001 00000038 00000005 00000030
+0000768 000000f2 00000005 00000001 0000003a
+0000784 00000005 00000030 000000f3 00000005
+0000800 00000001 0000003c 00000005 00000030
+0000816 000000f4 00000005 00000001 0000003e
+0000832 00000005 00000030 000000f5 00000005
+0000848 00000001 00000040 00000005 00000030
+0000864 000000e6 00000005 00000001 00000042
+0000880 00000005 00000030 000000e7 00000005
+0000896 00000032 00000044 00000005 00000030
+0000912 000000e8 00000005 00000001 00000046
+0000928 00000005 00000030 000000e9 00000005
+0000944 00000032 00000048 00000005 00000030
+0000960 000000ea 00000005 00000001 0000004a
+0000976 00000005 00000030 000000eb 00000005
+0000992 00000001 0000004c 00000005 00000030
+0001008 000000ec 00000005 00000001 0000004e
+0001024 00000005 00000030 000000ed 00000005
+0001040 00000001 00000050 00000005 00000001
+0001056 00000032 00000005 00000029 000000fe
+0001072 00000005 00000053 00000053 00000005
+0001088 000000e6 000000e6 00000005 000000e7
+0001104 000000e7 00000005 000000e8 000000e8
+0001120 00000005 000000e9 000000e9 00000005
+0001136 00000000 00000000 00000005 00000001
+0001152 00000055 00000005 00000055 0000005a
+0001168 00000005 00000001 0000005a 00000005
+0001184 0000005b 0000005c 00000005 00000055
+0001200 00000055 00000005 0000005d 0000005d
+0001216 00000005 0000005e 0000005f 00000005
+0001232 00000001 00000056 00000005 00000056
+0001248 00000061 00000005 00000001 00000061
+0001264 00000005 00000062 00000063 00000005
+0001280 00000060 00000064 00000005 00000065
+0001296 00000065 00000005 00000056 00000056
+0001312 00000005 00000066 00000066 00000005
+0001328 00000067 00000068 00000005 00000057
+0001344 00000069 00000005 0000006a 0000006a
+0001360 00000005 00000058 0000006b 00000005
+0001376 0000006c 0000006c 00000005 00000059
+0001392 0000006d 00000005 0000006e 0000006e
+0001408 00000005 00000059 0000006f 00000005
+0001424 00000070 00000070 00000005 00000059
+0001440 00000071 00000005 00000072 00000072
+0001456 00000005 00000059 00000073 00000005
+0001472 00000059 00000074 00000005 00000073
+0001488 00000074 00000005 00000075 00000076
+0001504 00000005 00000001 00000077 00000005
+0001520 00000001 00000078 00000005 00000054
+0001536 00000054 00000005 00000052 0000007a
+0001552 00000005 00000054 00000079 00000005
+0001568 0000007b 0000007c 00000005 00000001
+0001584 00000054 00000005 00000001 0000007e
+0001600 00000005 00000023 000000ff 00000005
+0001616 00000080 00000080 00000005 00000081
+0001632 000000fe 00000005 00000082 00000082
+0001648 00000005 00000001 00000001 00000005
+0001664 00000084 000000e6 00000005 00000084
+0001680 00000085 00000005 00000085 000000e6
+0001696 00000005 00000086 00000087 00000005
+0001712 00000001 00000088 00000005 00000088
+0001728 00000089 00000005 00000001 00000089
+0001744 00000005 0000008a 0000008b 00000005
+0001760 00000085 00000085 00000005 0000008d
+0001776 0000008d 00000005 00000088 00000088
+0001792 00000005 0000008e 0000008f 00000005
+0001808 00000059 000000e7 00000005 00000059
+0001824 00000091 00000005 00000091 000000e7
+0001840 00000005 00000092 00000093 00000005
+0001856 00000090 00000094 00000005 00000094
+0001872 00000095 00000005 00000090 00000095
+0001888 00000005 00000096 00000097 00000005
+0001904 00000091 00000091 00000005 00000095
+0001920 00000095 00000005 00000099 00000099
+0001936 00000005 0000009a 0000009a 00000005
+0001952 0000009b 0000009c 00000005 00000059
+0001968 000000e8 00000005 00000059 0000009e
+0001984 00000005 0000009e 000000e8 00000005
+0002000 0000009f 000000a0 00000005 0000009d
+0002016 000000a1 00000005 000000a1 000000a2
+0002032 00000005 0000009d 000000a2 00000005
+0002048 000000a3 000000a4 00000005 0000009e
+0002064 0000009e 00000005 000000a2 000000a2
+0002080 00000005 000000a6 000000a6 00000005
+0002096 000000a7 000000a7 00000005 000000a8
+0002112 000000a9 00000005 00000059 000000e9
+0002128 00000005 00000059 000000ab 00000005
+0002144 000000ab 000000e9 00000005 000000ac
+0002160 000000ad 00000005 000000aa 000000ae
+0002176 00000005 000000ae 000000af 00000005
+0002192 000000aa 000000af 00000005 000000b0
+0002208 000000b1 00000005 00000083 00000083
+0002224 00000005 00000043 000000b3 00000005
+0002240 00000083 0000008c 00000005 000000b4
+0002256 000000b5 00000005 00000045 000000b3
+0002272 00000005 00000083 00000098 00000005
+0002288 000000b7 000000b8 00000005 00000047
+0002304 000000b3 00000005 00000083 000000a5
+0002320 00000005 000000ba 000000bb 00000005
+0002336 00000049 000000b3 00000005 00000083
+0002352 000000b2 00000005 000000bd 000000be
+0002368 00000005 0000004b 000000b3 00000005
+0002384 00000001 000000c0 00000005 0000004d
+0002400 000000b3 00000005 00000001 000000c2
+0002416 00000005 0000004f 000000b3 00000005
+0002432 00000001 000000c4 00000005 00000051
+0002448 000000b3 00000005 00000001 000000c6
+0002464 00000005 0000007d 000000b3 00000005
+0002480 00000001 00000083 00000005 000000c8
+0002496 000000c9 00000005 0000007f 000000b3
+0002512 00000005 00000001 000000cb 00000005
+0002528 0000002d 00000081 00000005 000000cd
+0002544 000000cd 00000005 000000ce 000000ce
+0002560 00000005 000000cf 000000f6 00000005
+0002576 00000001 000000d0 00000005 000000cf
+0002592 000000f7 00000005 00000001 000000d2
+0002608 00000005 000000cf 000000f8 00000005
+0002624 00000001 000000d4 00000005 000000cf
+0002640 000000f9 00000005 00000001 000000d6
+0002656 00000005 000000cf 000000fa 00000005
+0002672 00000001 000000d8 00000005 000000cf
+0002688 000000fb 00000005 00000001 000000da
+0002704 00000005 000000cf 000000fc 00000005
+0002720 00000001 000000dc 00000005 000000cf
+0002736 000000fd 00000005 00000001 000000de
+0002752 00000005 000000ca 000000cf 00000005
+0002768 00000001 000000e0 00000005 000000cc
+0002784 000000cf 00000005 00000001 000000e2
+0002800 00000005 00000001 000000ce 00000005
+0002816 00000001 000000e4 00000000 00000001
+0002832 00000001 00000001 000000e6 00000002
+0002848 00000001 00000001 00000001 000000ee
+0002864 00000004 00000001 00000001 00000001
+0002880 000000f6 00000006 00000000 00000000
+0002896 00000001 000000fe 000000e6 000000b6
+0002912 000000e7 000000b9 000000e8 000000bc
+0002928 000000e9 000000bf 000000ea 000000c1
+0002944 000000eb 000000c3 000000ec 000000c5
+0002960 000000ed 000000c7 000000ee 00000033
+0002976 000000ef 00000035 000000f0 00000037
+0002992 000000f1 00000039 000000f2 0000003b
+0003008 000000f3 0000003d 000000f4 0000003f
+0003024 000000f5 00000041 000000f6 000000d1
+0003040 000000f7 000000d3 000000f8 000000d5
+0003056 000000f9 000000d7 000000fa 000000d9
+0003072 000000fb 000000db 000000fc 000000dd
+0003088 000000fd 000000df 000000fe 000000e1
+0003104 000000ff 000000e3 00000100 000000e5
+0003120 00000101 00000000 00000102 00000000
+0003136 00000103 00000000 00000104 00000000
+0003152 00000105 00000000 00620061 54530063
+0003168 00455441
+0003172
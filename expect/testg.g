@@ -0,0 +1,262 @@
+G2 = nand(_1, STATE_0_0_7)
+G3 = nand(_1, G2)
+G4 = nand(G2, STATE_0_0_7)
+G5 = nand(G3, G4)
+G6 = nand(_1, STATE_0_0_6)
+G7 = nand(_1, G6)
+G8 = nand(G6, STATE_0_0_6)
+G9 = nand(G7, G8)
+G10 = nand(G5, G9)
+G11 = nand(G10, G10)
+G12 = nand(_1, STATE_0_0_5)
+G13 = nand(_1, G12)
+G14 = nand(G12, STATE_0_0_5)
+G15 = nand(G13, G14)
+G16 = nand(G11, G15)
+G17 = nand(G16, G16)
+G18 = nand(_1, STATE_0_0_4)
+G19 = nand(_1, G18)
+G20 = nand(G18, STATE_0_0_4)
+G21 = nand(G19, G20)
+G22 = nand(G17, G21)
+G23 = nand(G22, G22)
+G24 = nand(_1, STATE_0_0_3)
+G25 = nand(_1, G24)
+G26 = nand(G24, STATE_0_0_3)
+G27 = nand(G25, G26)
+G28 = nand(G23, G27)
+G29 = nand(G28, G28)
+G30 = nand(_1, STATE_0_0_2)
+G31 = nand(_1, G30)
+G32 = nand(G30, STATE_0_0_2)
+G33 = nand(G31, G32)
+G34 = nand(G29, G33)
+G35 = nand(G34, G34)
+G36 = nand(_1, STATE_0_0_1)
+G37 = nand(_1, G36)
+G38 = nand(G36, STATE_0_0_1)
+G39 = nand(G37, G38)
+G40 = nand(G35, G39)
+G41 = nand(G40, G40)
+G42 = nand(_1, STATE_0_0_0)
+G43 = nand(_1, G42)
+G44 = nand(G42, STATE_0_0_0)
+G45 = nand(G43, G44)
+G46 = nand(G41, G45)
+G47 = nand(G46, G46)
+G48 = nand(G47, G47)
+G49 = nand(G48, b_1_1_0)
+G50 = nand(_1, G47)
+G51 = nand(G49, G50)
+G52 = nand(G48, b_1_1_1)
+G53 = nand(G50, G52)
+G54 = nand(G48, b_1_1_2)
+G55 = nand(_1, G54)
+G56 = nand(G48, b_1_1_3)
+G57 = nand(_1, G56)
+G58 = nand(G48, b_1_1_4)
+G59 = nand(_1, G58)
+G60 = nand(G48, b_1_1_5)
+G61 = nand(_1, G60)
+G62 = nand(G48, b_1_1_6)
+G63 = nand(_1, G62)
+G64 = nand(G48, b_1_1_7)
+G65 = nand(_1, G64)
+G66 = nand(G48, a_1_1_0)
+G67 = nand(_1, G66)
+G68 = nand(G48, a_1_1_1)
+G69 = nand(G50, G68)
+G70 = nand(G48, a_1_1_2)
+G71 = nand(_1, G70)
+G72 = nand(G48, a_1_1_3)
+G73 = nand(G50, G72)
+G74 = nand(G48, a_1_1_4)
+G75 = nand(_1, G74)
+G76 = nand(G48, a_1_1_5)
+G77 = nand(_1, G76)
+G78 = nand(G48, a_1_1_6)
+G79 = nand(_1, G78)
+G80 = nand(G48, a_1_1_7)
+G81 = nand(_1, G80)
+G82 = nand(_1, G50)
+G83 = nand(G41, STATE_0_0_0)
+G84 = nand(G83, G83)
+G85 = nand(a_1_1_0, a_1_1_0)
+G86 = nand(a_1_1_1, a_1_1_1)
+G87 = nand(a_1_1_2, a_1_1_2)
+G88 = nand(a_1_1_3, a_1_1_3)
+G89 = nand(_0, _0)
+G90 = nand(_1, G85)
+G91 = nand(G85, G90)
+G92 = nand(_1, G90)
+G93 = nand(G91, G92)
+G94 = nand(G85, G85)
+G95 = nand(G93, G93)
+G96 = nand(G94, G95)
+G97 = nand(_1, G86)
+G98 = nand(G86, G97)
+G99 = nand(_1, G97)
+G100 = nand(G98, G99)
+G101 = nand(G96, G100)
+G102 = nand(G101, G101)
+G103 = nand(G86, G86)
+G104 = nand(G102, G102)
+G105 = nand(G103, G104)
+G106 = nand(G87, G105)
+G107 = nand(G106, G106)
+G108 = nand(G88, G107)
+G109 = nand(G108, G108)
+G110 = nand(G89, G109)
+G111 = nand(G110, G110)
+G112 = nand(G89, G111)
+G113 = nand(G112, G112)
+G114 = nand(G89, G113)
+G115 = nand(G114, G114)
+G116 = nand(G89, G115)
+G117 = nand(G89, G116)
+G118 = nand(G115, G116)
+G119 = nand(G117, G118)
+G120 = nand(_1, G119)
+G121 = nand(_1, G120)
+G122 = nand(G84, G84)
+G123 = nand(G82, G122)
+G124 = nand(G84, G121)
+G125 = nand(G123, G124)
+G126 = nand(_1, G84)
+G127 = nand(_1, G126)
+G128 = nand(G35, STATE_0_0_1)
+G129 = nand(G128, G128)
+G130 = nand(G129, STATE_0_0_0)
+G131 = nand(G130, G130)
+G132 = nand(_1, _1)
+G133 = nand(G132, a_1_1_0)
+G134 = nand(G132, G133)
+G135 = nand(G133, a_1_1_0)
+G136 = nand(G134, G135)
+G137 = nand(_1, G136)
+G138 = nand(G136, G137)
+G139 = nand(_1, G137)
+G140 = nand(G138, G139)
+G141 = nand(G133, G133)
+G142 = nand(G141, G141)
+G143 = nand(G136, G136)
+G144 = nand(G142, G143)
+G145 = nand(G89, a_1_1_1)
+G146 = nand(G89, G145)
+G147 = nand(G145, a_1_1_1)
+G148 = nand(G146, G147)
+G149 = nand(G144, G148)
+G150 = nand(G148, G149)
+G151 = nand(G144, G149)
+G152 = nand(G150, G151)
+G153 = nand(G145, G145)
+G154 = nand(G149, G149)
+G155 = nand(G153, G153)
+G156 = nand(G154, G154)
+G157 = nand(G155, G156)
+G158 = nand(G89, a_1_1_2)
+G159 = nand(G89, G158)
+G160 = nand(G158, a_1_1_2)
+G161 = nand(G159, G160)
+G162 = nand(G157, G161)
+G163 = nand(G161, G162)
+G164 = nand(G157, G162)
+G165 = nand(G163, G164)
+G166 = nand(G158, G158)
+G167 = nand(G162, G162)
+G168 = nand(G166, G166)
+G169 = nand(G167, G167)
+G170 = nand(G168, G169)
+G171 = nand(G89, a_1_1_3)
+G172 = nand(G89, G171)
+G173 = nand(G171, a_1_1_3)
+G174 = nand(G172, G173)
+G175 = nand(G170, G174)
+G176 = nand(G174, G175)
+G177 = nand(G170, G175)
+G178 = nand(G176, G177)
+G179 = nand(G131, G131)
+G180 = nand(G67, G179)
+G181 = nand(G131, G140)
+G182 = nand(G180, G181)
+G183 = nand(G69, G179)
+G184 = nand(G131, G152)
+G185 = nand(G183, G184)
+G186 = nand(G71, G179)
+G187 = nand(G131, G165)
+G188 = nand(G186, G187)
+G189 = nand(G73, G179)
+G190 = nand(G131, G178)
+G191 = nand(G189, G190)
+G192 = nand(G75, G179)
+G193 = nand(_1, G192)
+G194 = nand(G77, G179)
+G195 = nand(_1, G194)
+G196 = nand(G79, G179)
+G197 = nand(_1, G196)
+G198 = nand(G81, G179)
+G199 = nand(_1, G198)
+G200 = nand(G125, G179)
+G201 = nand(_1, G131)
+G202 = nand(G200, G201)
+G203 = nand(G127, G179)
+G204 = nand(_1, G203)
+G205 = nand(G45, G129)
+G206 = nand(G205, G205)
+G207 = nand(G206, G206)
+G208 = nand(G207, c_1_1_0)
+G209 = nand(_1, G208)
+G210 = nand(G207, c_1_1_1)
+G211 = nand(_1, G210)
+G212 = nand(G207, c_1_1_2)
+G213 = nand(_1, G212)
+G214 = nand(G207, c_1_1_3)
+G215 = nand(_1, G214)
+G216 = nand(G207, c_1_1_4)
+G217 = nand(_1, G216)
+G218 = nand(G207, c_1_1_5)
+G219 = nand(_1, G218)
+G220 = nand(G207, c_1_1_6)
+G221 = nand(_1, G220)
+G222 = nand(G207, c_1_1_7)
+G223 = nand(_1, G222)
+G224 = nand(G202, G207)
+G225 = nand(_1, G224)
+G226 = nand(G204, G207)
+G227 = nand(_1, G226)
+G228 = nand(_1, G206)
+G229 = nand(_1, G228)
+_a_1_1_0 = G182
+_a_1_1_1 = G185
+_a_1_1_2 = G188
+_a_1_1_3 = G191
+_a_1_1_4 = G193
+_a_1_1_5 = G195
+_a_1_1_6 = G197
+_a_1_1_7 = G199
+_b_1_1_0 = G51
+_b_1_1_1 = G53
+_b_1_1_2 = G55
+_b_1_1_3 = G57
+_b_1_1_4 = G59
+_b_1_1_5 = G61
+_b_1_1_6 = G63
+_b_1_1_7 = G65
+_c_1_1_0 = G209
+_c_1_1_1 = G211
+_c_1_1_2 = G213
+_c_1_1_3 = G215
+_c_1_1_4 = G217
+_c_1_1_5 = G219
+_c_1_1_6 = G221
+_c_1_1_7 = G223
+_STATE_0_0_0 = G225
+_STATE_0_0_1 = G227
+_STATE_0_0_2 = G229
+_STATE_0_0_3 = _0
+_STATE_0_0_4 = _0
+_STATE_0_0_5 = _0
+_STATE_0_0_6 = _0
+_STATE_0_0_7 = _0
+
+
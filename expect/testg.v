@@ -0,0 +1,291 @@
+module statemachine(halt, clk);
+output halt;
+input clk;
+reg [7:0] a_1_1;
+reg [7:0] b_1_1;
+reg [7:0] c_1_1;
+reg [7:0] STATE_0_0 = 0;
+wire [227:0] w;
+
+nand(w[0], 1, STATE_0_0[7]);
+nand(w[1], 1, w[0]);
+nand(w[2], w[0], STATE_0_0[7]);
+nand(w[3], w[1], w[2]);
+nand(w[4], 1, STATE_0_0[6]);
+nand(w[5], 1, w[4]);
+nand(w[6], w[4], STATE_0_0[6]);
+nand(w[7], w[5], w[6]);
+nand(w[8], w[3], w[7]);
+nand(w[9], w[8], w[8]);
+nand(w[10], 1, STATE_0_0[5]);
+nand(w[11], 1, w[10]);
+nand(w[12], w[10], STATE_0_0[5]);
+nand(w[13], w[11], w[12]);
+nand(w[14], w[9], w[13]);
+nand(w[15], w[14], w[14]);
+nand(w[16], 1, STATE_0_0[4]);
+nand(w[17], 1, w[16]);
+nand(w[18], w[16], STATE_0_0[4]);
+nand(w[19], w[17], w[18]);
+nand(w[20], w[15], w[19]);
+nand(w[21], w[20], w[20]);
+nand(w[22], 1, STATE_0_0[3]);
+nand(w[23], 1, w[22]);
+nand(w[24], w[22], STATE_0_0[3]);
+nand(w[25], w[23], w[24]);
+nand(w[26], w[21], w[25]);
+nand(w[27], w[26], w[26]);
+nand(w[28], 1, STATE_0_0[2]);
+nand(w[29], 1, w[28]);
+nand(w[30], w[28], STATE_0_0[2]);
+nand(w[31], w[29], w[30]);
+nand(w[32], w[27], w[31]);
+nand(w[33], w[32], w[32]);
+nand(w[34], 1, STATE_0_0[1]);
+nand(w[35], 1, w[34]);
+nand(w[36], w[34], STATE_0_0[1]);
+nand(w[37], w[35], w[36]);
+nand(w[38], w[33], w[37]);
+nand(w[39], w[38], w[38]);
+nand(w[40], 1, STATE_0_0[0]);
+nand(w[41], 1, w[40]);
+nand(w[42], w[40], STATE_0_0[0]);
+nand(w[43], w[41], w[42]);
+nand(w[44], w[39], w[43]);
+nand(w[45], w[44], w[44]);
+nand(w[46], w[45], w[45]);
+nand(w[47], w[46], b_1_1[0]);
+nand(w[48], 1, w[45]);
+nand(w[49], w[47], w[48]);
+nand(w[50], w[46], b_1_1[1]);
+nand(w[51], w[48], w[50]);
+nand(w[52], w[46], b_1_1[2]);
+nand(w[53], 1, w[52]);
+nand(w[54], w[46], b_1_1[3]);
+nand(w[55], 1, w[54]);
+nand(w[56], w[46], b_1_1[4]);
+nand(w[57], 1, w[56]);
+nand(w[58], w[46], b_1_1[5]);
+nand(w[59], 1, w[58]);
+nand(w[60], w[46], b_1_1[6]);
+nand(w[61], 1, w[60]);
+nand(w[62], w[46], b_1_1[7]);
+nand(w[63], 1, w[62]);
+nand(w[64], w[46], a_1_1[0]);
+nand(w[65], 1, w[64]);
+nand(w[66], w[46], a_1_1[1]);
+nand(w[67], w[48], w[66]);
+nand(w[68], w[46], a_1_1[2]);
+nand(w[69], 1, w[68]);
+nand(w[70], w[46], a_1_1[3]);
+nand(w[71], w[48], w[70]);
+nand(w[72], w[46], a_1_1[4]);
+nand(w[73], 1, w[72]);
+nand(w[74], w[46], a_1_1[5]);
+nand(w[75], 1, w[74]);
+nand(w[76], w[46], a_1_1[6]);
+nand(w[77], 1, w[76]);
+nand(w[78], w[46], a_1_1[7]);
+nand(w[79], 1, w[78]);
+nand(w[80], 1, w[48]);
+nand(w[81], w[39], STATE_0_0[0]);
+nand(w[82], w[81], w[81]);
+nand(w[83], a_1_1[0], a_1_1[0]);
+nand(w[84], a_1_1[1], a_1_1[1]);
+nand(w[85], a_1_1[2], a_1_1[2]);
+nand(w[86], a_1_1[3], a_1_1[3]);
+nand(w[87], 0, 0);
+nand(w[88], 1, w[83]);
+nand(w[89], w[83], w[88]);
+nand(w[90], 1, w[88]);
+nand(w[91], w[89], w[90]);
+nand(w[92], w[83], w[83]);
+nand(w[93], w[91], w[91]);
+nand(w[94], w[92], w[93]);
+nand(w[95], 1, w[84]);
+nand(w[96], w[84], w[95]);
+nand(w[97], 1, w[95]);
+nand(w[98], w[96], w[97]);
+nand(w[99], w[94], w[98]);
+nand(w[100], w[99], w[99]);
+nand(w[101], w[84], w[84]);
+nand(w[102], w[100], w[100]);
+nand(w[103], w[101], w[102]);
+nand(w[104], w[85], w[103]);
+nand(w[105], w[104], w[104]);
+nand(w[106], w[86], w[105]);
+nand(w[107], w[106], w[106]);
+nand(w[108], w[87], w[107]);
+nand(w[109], w[108], w[108]);
+nand(w[110], w[87], w[109]);
+nand(w[111], w[110], w[110]);
+nand(w[112], w[87], w[111]);
+nand(w[113], w[112], w[112]);
+nand(w[114], w[87], w[113]);
+nand(w[115], w[87], w[114]);
+nand(w[116], w[113], w[114]);
+nand(w[117], w[115], w[116]);
+nand(w[118], 1, w[117]);
+nand(w[119], 1, w[118]);
+nand(w[120], w[82], w[82]);
+nand(w[121], w[80], w[120]);
+nand(w[122], w[82], w[119]);
+nand(w[123], w[121], w[122]);
+nand(w[124], 1, w[82]);
+nand(w[125], 1, w[124]);
+nand(w[126], w[33], STATE_0_0[1]);
+nand(w[127], w[126], w[126]);
+nand(w[128], w[127], STATE_0_0[0]);
+nand(w[129], w[128], w[128]);
+nand(w[130], 1, 1);
+nand(w[131], w[130], a_1_1[0]);
+nand(w[132], w[130], w[131]);
+nand(w[133], w[131], a_1_1[0]);
+nand(w[134], w[132], w[133]);
+nand(w[135], 1, w[134]);
+nand(w[136], w[134], w[135]);
+nand(w[137], 1, w[135]);
+nand(w[138], w[136], w[137]);
+nand(w[139], w[131], w[131]);
+nand(w[140], w[139], w[139]);
+nand(w[141], w[134], w[134]);
+nand(w[142], w[140], w[141]);
+nand(w[143], w[87], a_1_1[1]);
+nand(w[144], w[87], w[143]);
+nand(w[145], w[143], a_1_1[1]);
+nand(w[146], w[144], w[145]);
+nand(w[147], w[142], w[146]);
+nand(w[148], w[146], w[147]);
+nand(w[149], w[142], w[147]);
+nand(w[150], w[148], w[149]);
+nand(w[151], w[143], w[143]);
+nand(w[152], w[147], w[147]);
+nand(w[153], w[151], w[151]);
+nand(w[154], w[152], w[152]);
+nand(w[155], w[153], w[154]);
+nand(w[156], w[87], a_1_1[2]);
+nand(w[157], w[87], w[156]);
+nand(w[158], w[156], a_1_1[2]);
+nand(w[159], w[157], w[158]);
+nand(w[160], w[155], w[159]);
+nand(w[161], w[159], w[160]);
+nand(w[162], w[155], w[160]);
+nand(w[163], w[161], w[162]);
+nand(w[164], w[156], w[156]);
+nand(w[165], w[160], w[160]);
+nand(w[166], w[164], w[164]);
+nand(w[167], w[165], w[165]);
+nand(w[168], w[166], w[167]);
+nand(w[169], w[87], a_1_1[3]);
+nand(w[170], w[87], w[169]);
+nand(w[171], w[169], a_1_1[3]);
+nand(w[172], w[170], w[171]);
+nand(w[173], w[168], w[172]);
+nand(w[174], w[172], w[173]);
+nand(w[175], w[168], w[173]);
+nand(w[176], w[174], w[175]);
+nand(w[177], w[129], w[129]);
+nand(w[178], w[65], w[177]);
+nand(w[179], w[129], w[138]);
+nand(w[180], w[178], w[179]);
+nand(w[181], w[67], w[177]);
+nand(w[182], w[129], w[150]);
+nand(w[183], w[181], w[182]);
+nand(w[184], w[69], w[177]);
+nand(w[185], w[129], w[163]);
+nand(w[186], w[184], w[185]);
+nand(w[187], w[71], w[177]);
+nand(w[188], w[129], w[176]);
+nand(w[189], w[187], w[188]);
+nand(w[190], w[73], w[177]);
+nand(w[191], 1, w[190]);
+nand(w[192], w[75], w[177]);
+nand(w[193], 1, w[192]);
+nand(w[194], w[77], w[177]);
+nand(w[195], 1, w[194]);
+nand(w[196], w[79], w[177]);
+nand(w[197], 1, w[196]);
+nand(w[198], w[123], w[177]);
+nand(w[199], 1, w[129]);
+nand(w[200], w[198], w[199]);
+nand(w[201], w[125], w[177]);
+nand(w[202], 1, w[201]);
+nand(w[203], w[43], w[127]);
+nand(w[204], w[203], w[203]);
+nand(w[205], w[204], w[204]);
+nand(w[206], w[205], c_1_1[0]);
+nand(w[207], 1, w[206]);
+nand(w[208], w[205], c_1_1[1]);
+nand(w[209], 1, w[208]);
+nand(w[210], w[205], c_1_1[2]);
+nand(w[211], 1, w[210]);
+nand(w[212], w[205], c_1_1[3]);
+nand(w[213], 1, w[212]);
+nand(w[214], w[205], c_1_1[4]);
+nand(w[215], 1, w[214]);
+nand(w[216], w[205], c_1_1[5]);
+nand(w[217], 1, w[216]);
+nand(w[218], w[205], c_1_1[6]);
+nand(w[219], 1, w[218]);
+nand(w[220], w[205], c_1_1[7]);
+nand(w[221], 1, w[220]);
+nand(w[222], w[200], w[205]);
+nand(w[223], 1, w[222]);
+nand(w[224], w[202], w[205]);
+nand(w[225], 1, w[224]);
+nand(w[226], 1, w[204]);
+nand(w[227], 1, w[226]);
+assign halt = (STATE_0_0 == 4);
+always @(posedge clk) if (!halt) begin
+	a_1_1[0] <= w[180];
+	a_1_1[1] <= w[183];
+	a_1_1[2] <= w[186];
+	a_1_1[3] <= w[189];
+	a_1_1[4] <= w[191];
+	a_1_1[5] <= w[193];
+	a_1_1[6] <= w[195];
+	a_1_1[7] <= w[197];
+	b_1_1[0] <= w[49];
+	b_1_1[1] <= w[51];
+	b_1_1[2] <= w[53];
+	b_1_1[3] <= w[55];
+	b_1_1[4] <= w[57];
+	b_1_1[5] <= w[59];
+	b_1_1[6] <= w[61];
+	b_1_1[7] <= w[63];
+	c_1_1[0] <= w[207];
+	c_1_1[1] <= w[209];
+	c_1_1[2] <= w[211];
+	c_1_1[3] <= w[213];
+	c_1_1[4] <= w[215];
+	c_1_1[5] <= w[217];
+	c_1_1[6] <= w[219];
+	c_1_1[7] <= w[221];
+	STATE_0_0[0] <= w[223];
+	STATE_0_0[1] <= w[225];
+	STATE_0_0[2] <= w[227];
+	STATE_0_0[3] <= 0;
+	STATE_0_0[4] <= 0;
+	STATE_0_0[5] <= 0;
+	STATE_0_0[6] <= 0;
+	STATE_0_0[7] <= 0;
+end
+endmodule
+
+module testbench;
+wire halt;
+reg clk = 0;
+statemachine m(halt, clk);
+initial begin
+	$dumpfile;
+	$dumpvars(1,
+m.a_1_1,
+m.b_1_1,
+m.c_1_1,
+m.STATE_0_0);
+	while (!halt) begin
+		#1 clk <= !clk;
+	end
+	$finish;
+end
+endmodule
@@ -0,0 +1 @@
+Error in line 11:  5 states need -w 3 or wider
@@ -0,0 +1,513 @@
+lane	cycles	a_1_1	b_1_1	c_1_1	d_1_1	e_1_1	f_1_1	n_1_1	STATE_0_0
+0	3	0	0	0	5	1	0	0	4
+1	17	-58	-21	-79	28	1	106	-5	4
+2	19	95	-10	85	54	1	-8	-10	4
+3	19	-15	-13	-28	11	1	-120	-13	4
+4	19	46	-12	34	21	1	112	-12	4
+5	5	-65	-112	79	-112	2	-65	0	4
+6	5	-6	-112	-118	-107	2	-6	0	4
+7	11	-47	-77	-124	-53	1	68	-13	4
+8	7	37	-98	-61	-94	2	74	-2	4
+9	5	112	-115	-3	-106	2	112	-3	4
+10	5	9	10	19	-14	1	9	-6	4
+11	5	57	14	71	22	2	57	-2	4
+12	15	-32	88	56	109	2	64	-8	4
+13	5	-26	5	-21	6	2	-26	-11	4
+14	5	-1	-127	-128	-127	2	-1	-15	4
+15	9	104	39	-113	44	2	56	-9	4
+16	11	57	-72	-15	-68	2	-28	-8	4
+17	19	35	123	-98	-113	1	24	-5	4
+18	7	-102	-103	51	-98	2	52	-7	4
+19	17	106	-28	78	-23	2	-26	-12	4
+20	17	-91	-23	-114	25	1	-125	-7	4
+21	11	-29	52	23	72	1	-116	-12	4
+22	13	-13	-49	-62	-45	2	-65	-1	4
+23	7	-35	29	-6	29	1	-70	-3	4
+24	15	21	82	103	-42	2	126	-14	4
+25	17	-21	104	83	108	2	109	-8	4
+26	19	108	-8	100	25	1	96	-8	4
+27	15	-95	-42	119	110	2	-58	-10	4
+28	17	-56	-19	-75	22	1	120	-3	4
+29	15	28	-43	-15	90	2	-88	-11	4
+30	9	100	-86	14	-33	1	44	-6	4
+31	11	84	-75	9	-54	1	80	-11	4
+32	9	6	-81	-75	80	1	18	-1	4
+33	9	-95	46	-49	-42	1	-29	-2	4
+34	5	-23	13	-10	49	2	-23	-3	4
+35	19	-85	-12	-97	24	1	88	-12	4
+36	11	6	-74	-68	87	1	24	-10	4
+37	15	-109	-44	103	40	1	114	-12	4
+38	15	112	-34	78	-25	2	-96	-2	4
+39	19	55	119	-82	-9	1	-72	-9	4
+40	15	-23	90	67	98	2	118	-6	4
+41	5	23	1	24	1	2	23	-15	4
+42	9	63	45	108	45	2	-67	-3	4
+43	15	-90	83	-7	-12	2	-28	-13	4
+44	15	-79	-44	-123	104	2	38	-12	4
+45	7	-61	22	-39	106	1	-122	-10	4
+46	11	-57	-75	124	-43	1	28	-11	4
+47	17	70	106	-80	-101	1	-22	-6	4
+48	17	29	104	-123	-88	1	-53	-8	4
+49	9	-35	-93	-128	-25	1	-105	-13	4
+50	11	12	-66	-54	67	1	48	-2	4
+51	11	-103	59	-44	-61	1	100	-5	4
+52	11	107	-76	31	-40	1	-84	-12	4
+53	15	-110	-35	111	34	1	108	-3	4
+54	5	90	-124	-34	-119	2	90	-12	4
+55	7	-46	31	-15	100	1	-92	-1	4
+56	15	-92	-45	119	116	2	-40	-13	4
+57	9	100	42	-114	95	1	44	-6	4
+58	11	51	-69	-18	79	1	-52	-5	4
+59	17	-43	111	68	-77	1	-45	-1	4
+60	15	-19	81	62	113	2	-114	-15	4
+61	13	30	72	102	-55	2	-106	-8	4
+62	7	-121	-111	24	113	1	14	-15	4
+63	13	-31	-61	-92	-5	2	101	-13	4
+64	15	-42	-37	-79	44	1	4	-5	4
+65	9	93	37	-126	101	1	23	-11	4
+66	17	-51	102	51	-86	1	-101	-10	4
+67	19	38	-12	26	21	1	48	-12	4
+68	13	66	69	-121	-70	0	74	-11	4
+69	7	23	-105	-82	-105	1	46	-9	4
+70	17	-70	99	29	-24	2	22	-13	4
+71	11	61	-74	-13	-70	2	-12	-10	4
+72	11	-13	-73	-86	-53	1	-52	-9	4
+73	15	-85	85	0	-7	2	2	-11	4
+74	5	53	-114	-61	-110	2	53	-2	4
+75	17	-29	-25	-54	27	1	53	-9	4
+76	15	-100	92	-8	-35	1	-88	-4	4
+77	5	-79	-119	58	-99	2	-79	-7	4
+78	13	126	-56	70	-55	2	118	-8	4
+79	5	-57	10	-47	122	1	-57	-6	4
+80	5	88	11	99	16	2	88	-5	4
+81	5	109	12	121	12	2	109	-4	4
+82	5	5	3	8	7	2	5	-13	4
+83	7	104	-111	-7	-70	2	-48	-15	4
+84	7	-126	-96	34	101	0	4	0	4
+85	11	-17	-66	-83	-34	1	-68	-2	4
+86	11	-62	-68	126	-63	0	8	-4	4
+87	19	-25	116	91	-108	1	56	-12	4
+88	13	17	69	86	-39	2	85	-11	4
+89	15	-94	91	-3	-32	2	-52	-5	4
+90	3	-79	-128	49	-124	2	0	0	4
+91	19	-109	-12	-121	8	1	-104	-12	4
+92	19	13	-2	11	2	1	104	-2	4
+93	19	-37	119	82	-69	1	-40	-9	4
+94	19	17	125	-114	-127	1	-120	-3	4
+95	15	97	-40	57	-20	2	70	-8	4
+96	15	126	-32	94	-31	2	-12	0	4
+97	13	15	-61	-46	67	2	75	-13	4
+98	11	81	-65	16	-57	1	68	-1	4
+99	13	-1	-60	-61	-60	2	-5	-12	4
+100	7	-57	-99	100	-19	1	-114	-3	4
+101	13	61	78	-117	-46	2	49	-2	4
+102	5	-55	-120	81	-116	2	-55	-8	4
+103	5	-5	4	-1	8	2	-5	-12	4
+104	19	53	115	-88	-9	2	-88	-13	4
+105	13	-58	-53	-111	60	1	-34	-5	4
+106	19	-75	126	51	-126	1	-88	-2	4
+107	9	0	-95	-95	90	0	0	-15	4
+108	15	1	94	95	-90	0	6	-2	4
+109	5	-89	-118	49	-70	2	-89	-6	4
+110	13	-46	-48	-94	-43	2	26	0	4
+111	5	-61	10	-51	126	1	-61	-6	4
+112	17	65	-19	46	17	0	-57	-3	4
+113	15	-37	-35	-72	33	1	34	-3	4
+114	9	33	40	73	-36	1	99	-8	4
+115	7	-6	-100	-106	-95	2	-12	-4	4
+116	9	-122	39	-83	-40	1	-110	-9	4
+117	7	34	29	63	34	2	68	-3	4
+118	5	101	1	102	1	2	101	-15	4
+119	9	-92	-87	77	94	1	-20	-7	4
+120	19	-83	-6	-89	30	1	104	-6	4
+121	13	38	72	110	-7	2	-66	-8	4
+122	17	-100	-28	-128	37	1	68	-12	4
+123	7	63	17	80	17	2	126	-15	4
+124	15	116	-33	83	-32	2	-72	-1	4
+125	9	28	-86	-58	111	1	84	-6	4
+126	17	-86	-25	-111	108	2	-90	-9	4
+127	7	77	-103	-26	-7	1	-102	-7	4
+128	17	115	101	-40	121	2	37	-11	4
+129	7	-117	24	-93	-4	1	22	-8	4
+130	13	76	-62	14	-57	2	124	-14	4
+131	19	-6	114	108	119	2	-48	-14	4
+132	5	-68	11	-57	12	2	-68	-5	4
+133	11	-120	-74	62	95	1	32	-10	4
+134	5	94	-124	-30	-123	2	94	-12	4
+135	15	-54	-41	-95	60	1	-68	-9	4
+136	7	-50	-108	98	-11	1	-100	-12	4
+137	9	106	35	-115	40	2	62	-13	4
+138	13	-121	-53	82	59	1	-93	-5	4
+139	5	98	-114	-16	-77	2	98	-2	4
+140	17	-52	109	57	-110	1	-108	-3	4
+141	9	2	-93	-91	88	0	6	-13	4
+142	9	-92	-92	72	-91	2	-20	-12	4
+143	7	-27	28	1	44	2	-54	-4	4
+144	11	37	-64	-27	64	2	-108	0	4
+145	9	-8	37	29	46	2	-24	-11	4
+146	19	-37	-1	-38	3	1	-40	-1	4
+147	15	116	-33	83	-32	2	-72	-1	4
+148	11	58	-64	-6	69	2	-24	0	4
+149	19	-77	122	45	-114	1	-104	-6	4
+150	19	-79	115	36	-117	1	-120	-13	4
+151	7	74	25	99	126	1	-108	-7	4
+152	3	99	-128	-29	-124	2	0	0	4
+153	15	55	-41	14	87	2	74	-9	4
+154	19	-76	118	42	-117	1	-96	-10	4
+155	17	52	106	-98	-1	2	108	-6	4
+156	13	31	-54	-23	74	2	-101	-6	4
+157	19	98	-14	84	23	1	16	-14	4
+158	11	-65	57	-8	57	2	-4	-7	4
+159	15	14	-38	-24	59	1	84	-6	4
+160	13	115	-60	55	-40	2	63	-12	4
+161	11	99	63	-94	67	1	-116	-1	4
+162	17	-6	-28	-34	-23	2	-42	-12	4
+163	5	117	-121	-4	-101	2	117	-9	4
+164	17	-38	-28	-66	41	1	-10	-12	4
+165	15	122	-47	75	-42	2	-36	-15	4
+166	13	-73	77	4	-35	2	-109	-3	4
+167	5	-8	-127	121	-118	2	-8	-15	4
+168	17	-50	106	56	-85	1	-94	-6	4
+169	5	110	-122	-12	-121	2	110	-10	4
+170	11	-76	54	-22	-53	1	-48	-10	4
+171	11	-34	56	22	121	1	120	-8	4
+172	11	-54	58	4	95	1	40	-6	4
+173	11	-81	64	-17	-64	2	-68	0	4
+174	17	79	-22	57	42	1	41	-6	4
+175	7	-19	31	12	35	2	-38	-1	4
+176	9	-25	35	10	35	2	-75	-13	4
+177	7	-86	-102	68	-65	2	84	-6	4
+178	17	-101	-26	-127	42	1	61	-10	4
+179	15	-49	-32	-81	32	1	-38	0	4
+180	5	77	-121	-44	-117	2	77	-9	4
+181	5	18	-123	-105	-102	2	18	-11	4
+182	11	-47	63	16	71	1	68	-1	4
+183	11	-128	60	-68	-63	0	0	-4	4
+184	17	-80	-25	-105	124	2	-48	-9	4
+185	5	-59	-127	70	-127	2	-59	-15	4
+186	13	-120	-49	87	52	1	-88	-1	4
+187	7	78	-97	-19	-32	1	-100	-1	4
+188	13	73	-50	23	54	1	109	-2	4
+189	11	109	-76	33	-44	1	-76	-12	4
+190	5	-126	16	-110	-11	0	-126	0	4
+191	17	77	104	-75	-88	1	27	-8	4
+192	11	39	49	88	-47	1	-100	-15	4
+193	7	-125	-108	23	104	1	6	-12	4
+194	11	-86	51	-35	-40	1	-88	-13	4
+195	17	-76	105	29	-2	2	-20	-7	4
+196	15	68	-43	25	42	1	-104	-11	4
+197	17	-31	108	77	-112	1	39	-4	4
+198	13	-93	-48	115	116	2	47	0	4
+199	9	-76	41	-35	62	2	28	-7	4
+200	15	-62	94	32	-93	0	-116	-2	4
+201	9	127	-86	41	-86	2	125	-6	4
+202	15	110	-35	75	-2	2	-108	-3	4
+203	11	-26	-65	-91	-64	1	-104	-1	4
+204	15	-111	90	-21	-94	1	102	-6	4
+205	5	-43	9	-34	25	2	-43	-7	4
+206	9	-19	41	22	41	2	-57	-7	4
+207	13	9	-62	-53	74	2	45	-14	4
+208	7	-12	-106	-118	-85	2	-24	-10	4
+209	17	-99	-26	-125	42	1	75	-10	4
+210	5	-12	12	0	29	2	-12	-4	4
+211	9	122	-89	33	-84	2	110	-9	4
+212	7	-84	-107	65	-70	2	88	-11	4
+213	19	90	-9	81	60	1	-48	-9	4
+214	11	-40	-70	-110	-61	1	96	-6	4
+215	17	84	105	-67	-66	1	76	-7	4
+216	17	-30	-25	-55	28	1	46	-9	4
+217	19	-65	118	53	-10	2	-8	-10	4
+218	11	100	52	-104	85	1	-112	-12	4
+219	17	-7	-21	-28	-13	2	-49	-5	4
+220	19	-98	122	24	-69	1	-16	-6	4
+221	17	79	109	-68	-83	1	41	-3	4
+222	5	92	14	106	19	2	92	-2	4
+223	11	-37	51	14	119	1	108	-13	4
+224	7	106	31	-119	36	2	-44	-1	4
+225	17	16	103	119	-68	1	112	-9	4
+226	9	5	46	51	-46	1	15	-2	4
+227	15	-13	-32	-45	-28	2	-78	0	4
+228	5	0	9	9	-14	0	0	-7	4
+229	5	-25	-116	115	-68	2	-25	-4	4
+230	13	-117	-60	79	72	2	-73	-12	4
+231	17	-59	98	39	-90	1	99	-14	4
+232	17	-73	97	24	-31	2	1	-15	4
+233	15	30	95	125	-96	1	-76	-1	4
+234	5	38	11	49	60	2	38	-5	4
+235	7	-32	-96	-128	-91	1	-64	0	4
+236	15	-95	-32	-127	100	2	-58	0	4
+237	15	20	94	114	-93	1	120	-2	4
+238	17	-49	-21	-70	43	1	-87	-5	4
+239	13	107	72	-77	76	2	23	-8	4
+240	5	-41	13	-28	29	2	-41	-3	4
+241	19	-60	-2	-62	3	1	32	-2	4
+242	11	38	-67	-29	78	1	-104	-3	4
+243	19	-22	-4	-26	1	1	80	-4	4
+244	17	13	-18	-5	18	1	91	-2	4
+245	5	96	3	99	56	2	96	-13	4
+246	7	-127	-98	31	102	0	2	-2	4
+247	17	-14	109	95	114	2	-98	-3	4
+248	13	-9	-58	-67	-58	2	-45	-10	4
+249	19	1	-9	-8	15	0	8	-9	4
+250	17	-33	-28	-61	36	1	25	-12	4
+251	9	67	-84	-17	-48	1	-55	-4	4
+252	17	-28	101	73	-102	1	60	-11	4
+253	11	119	-69	50	-53	1	-36	-5	4
+254	15	-93	-35	-128	97	2	-46	-3	4
+255	17	52	98	-106	-25	2	108	-14	4
+256	9	31	35	66	-29	1	93	-13	4
+257	13	-50	71	21	72	2	6	-9	4
+258	15	-80	-41	-121	108	2	32	-9	4
+259	11	43	-78	-35	86	1	-84	-14	4
+260	11	-121	56	-65	-56	1	28	-8	4
+261	7	-122	-111	23	114	1	12	-15	4
+262	7	59	24	83	28	2	118	-8	4
+263	11	-112	-78	66	75	1	64	-14	4
+264	17	41	100	-115	-24	2	31	-12	4
+265	11	104	60	-92	65	1	-96	-4	4
+266	17	62	-21	41	108	2	-78	-5	4
+267	9	-60	-92	104	-27	1	76	-12	4
+268	15	69	89	-98	-87	1	-98	-7	4
+269	11	57	55	112	63	2	-28	-9	4
+270	9	22	-84	-62	125	1	66	-4	4
+271	5	-115	-127	14	-127	2	-115	-15	4
+272	5	119	-112	7	-112	2	119	0	4
+273	9	38	-90	-52	-89	1	114	-10	4
+274	17	32	103	-121	-100	1	-32	-9	4
+275	17	-36	-19	-55	50	1	4	-3	4
+276	11	42	61	103	-62	1	-88	-3	4
+277	15	-6	-39	-45	-34	2	-36	-7	4
+278	9	-109	42	-67	-2	1	-71	-6	4
+279	5	89	1	90	5	2	89	-15	4
+280	19	-7	-8	-15	-4	2	-56	-8	4
+281	11	-108	63	-45	-64	1	80	-1	4
+282	15	-24	-33	-57	-28	2	112	-1	4
+283	17	44	100	-112	-27	2	52	-12	4
+284	13	-32	-52	-84	-15	2	96	-4	4
+285	15	6	-37	-31	44	1	36	-5	4
+286	11	-16	-64	-80	-59	2	-64	0	4
+287	7	41	-98	-57	-90	2	82	-2	4
+288	9	-45	-90	121	-6	1	121	-10	4
+289	9	59	-92	-33	-88	2	-79	-12	4
+290	15	73	86	-97	-66	1	-74	-10	4
+291	15	-20	-45	-65	-12	2	-120	-13	4
+292	5	9	11	20	-13	1	9	-5	4
+293	17	-53	-27	-80	41	1	-115	-11	4
+294	15	-126	95	-31	-92	0	12	-1	4
+295	5	72	7	79	12	2	72	-9	4
+296	17	27	103	-126	-85	1	-67	-9	4
+297	9	-21	-86	-107	-82	2	-63	-6	4
+298	15	-8	-37	-45	-32	2	-48	-5	4
+299	15	18	82	100	-41	1	108	-14	4
+300	11	126	-74	52	-73	2	-8	-10	4
+301	7	-70	-103	83	-98	2	116	-7	4
+302	9	-75	-94	87	-90	2	31	-14	4
+303	17	66	106	-84	-97	0	-50	-6	4
+304	13	-90	-59	107	70	2	62	-11	4
+305	13	-43	75	32	95	2	41	-5	4
+306	9	-32	47	15	84	1	-96	-1	4
+307	17	99	-21	78	31	1	-75	-5	4
+308	11	-18	64	46	65	2	-72	0	4
+309	19	-18	113	95	-110	1	112	-15	4
+310	15	37	-40	-3	104	2	-34	-8	4
+311	11	126	-74	52	-73	2	-8	-10	4
+312	9	-117	-92	47	104	1	-95	-12	4
+313	19	-125	-15	116	21	1	24	-15	4
+314	11	82	-79	3	-10	1	72	-15	4
+315	11	-27	-68	-95	-52	1	-108	-4	4
+316	15	-14	-36	-50	-31	2	-84	-4	4
+317	17	31	110	-115	-82	1	-39	-2	4
+318	9	19	34	53	-26	1	57	-14	4
+319	15	18	-43	-25	42	1	108	-11	4
+320	5	-98	15	-83	16	2	-98	-1	4
+321	9	-74	-91	91	-90	2	34	-11	4
+322	11	-91	54	-37	-54	1	-108	-10	4
+323	17	102	112	-42	-111	1	-54	0	4
+324	17	-116	-21	119	44	1	-44	-5	4
+325	19	9	117	126	-103	1	72	-11	4
+326	7	69	-107	-38	-11	1	-118	-11	4
+327	5	81	-120	-39	-100	2	81	-8	4
+328	19	109	119	-28	-101	1	104	-9	4
+329	9	-9	45	36	61	2	-27	-3	4
+330	13	85	-56	29	-40	2	-87	-8	4
+331	7	74	-98	-24	-29	1	-108	-2	4
+332	13	-115	-49	92	51	1	-63	-1	4
+333	13	121	-48	73	-44	2	93	0	4
+334	17	-49	105	56	-87	1	-87	-7	4
+335	19	126	122	-8	123	2	-16	-6	4
+336	13	106	75	-75	112	2	18	-5	4
+337	13	-13	71	58	91	2	-65	-9	4
+338	9	102	-92	10	-91	2	50	-12	4
+339	11	14	-67	-53	94	1	56	-3	4
+340	11	-118	63	-55	-60	1	40	-1	4
+341	5	-13	15	2	19	2	-13	-1	4
+342	15	19	92	111	-96	1	114	-4	4
+343	15	-20	-42	-62	-5	2	-120	-10	4
+344	7	3	22	25	-22	1	6	-10	4
+345	7	10	30	40	-29	1	20	-2	4
+346	11	-25	61	36	77	1	-100	-3	4
+347	19	-30	-7	-37	14	1	16	-7	4
+348	17	-33	112	79	-80	1	25	0	4
+349	9	3	-82	-79	82	1	9	-2	4
+350	19	-98	-8	-106	57	1	-16	-8	4
+351	17	6	-29	-23	36	1	42	-13	4
+352	15	58	88	-110	-35	2	92	-8	4
+353	15	28	-38	-10	95	2	-88	-6	4
+354	5	5	7	12	-5	1	5	-9	4
+355	9	-8	33	25	42	2	-24	-15	4
+356	5	66	-125	-59	-8	0	66	-13	4
+357	11	29	61	90	-3	1	116	-3	4
+358	7	14	-100	-86	125	1	28	-4	4
+359	13	-15	73	58	93	2	-75	-7	4
+360	15	-49	84	35	-76	1	-38	-12	4
+361	15	-99	-33	124	35	1	-82	-1	4
+362	13	-4	67	63	68	2	-20	-13	4
+363	9	68	-87	-19	-34	1	-52	-7	4
+364	19	96	-15	81	10	1	0	-15	4
+365	17	6	-26	-20	39	1	42	-10	4
+366	7	127	-98	29	-98	2	-2	-2	4
+367	9	-101	33	-68	-27	1	-47	-15	4
+368	9	93	46	-117	114	1	23	-2	4
+369	19	-16	-5	-21	0	1	-128	-5	4
+370	9	109	48	-99	80	1	71	0	4
+371	17	3	110	113	-110	1	21	-2	4
+372	19	-124	115	-9	-108	1	32	-13	4
+373	17	84	111	-61	-80	1	76	-1	4
+374	19	-67	125	58	-3	1	-24	-3	4
+375	7	19	-98	-79	98	1	38	-2	4
+376	11	44	61	105	-62	1	-80	-3	4
+377	9	-99	-84	73	108	1	-41	-4	4
+378	5	-66	-124	66	-123	2	-66	-12	4
+379	5	-36	13	-23	18	2	-36	-3	4
+380	9	-34	-87	-121	-22	1	-102	-7	4
+381	5	-37	-117	102	-113	2	-37	-5	4
+382	15	46	85	-125	-10	2	20	-11	4
+383	5	-26	-118	112	-69	2	-26	-6	4
+384	15	42	90	-124	-1	2	-4	-6	4
+385	7	-118	-96	42	101	1	20	0	4
+386	11	64	-73	-9	-52	0	0	-9	4
+387	3	-51	-128	77	-128	2	0	0	4
+388	9	-42	-88	126	-7	1	-126	-8	4
+389	17	-96	105	9	-110	1	96	-7	4
+390	13	81	68	-107	88	2	-107	-12	4
+391	19	63	119	-74	-9	2	-8	-9	4
+392	17	-49	-16	-65	16	1	-87	0	4
+393	17	-32	108	76	-111	1	32	-4	4
+394	11	-85	64	-21	-60	2	-84	0	4
+395	19	-67	-4	-71	124	2	-24	-4	4
+396	15	112	93	-51	102	2	-96	-3	4
+397	11	83	60	-113	64	1	76	-4	4
+398	17	42	108	-106	-111	1	38	-4	4
+399	11	-24	63	39	68	1	-96	-1	4
+400	15	93	-38	55	-34	2	46	-6	4
+401	13	40	-56	-16	77	2	-56	-8	4
+402	17	67	107	-82	-97	1	-43	-5	4
+403	11	-103	-73	80	127	1	100	-9	4
+404	5	111	15	126	15	2	111	-1	4
+405	5	122	-118	4	-113	2	122	-6	4
+406	19	-68	123	55	-4	2	-32	-5	4
+407	19	21	-9	12	11	1	-88	-9	4
+408	15	66	-43	23	42	0	-116	-11	4
+409	11	119	-70	49	-54	1	-36	-6	4
+410	13	-9	-49	-58	-33	2	-45	-1	4
+411	15	-85	-45	126	119	2	2	-13	4
+412	15	11	84	95	-72	1	66	-12	4
+413	13	15	-60	-45	68	2	75	-12	4
+414	9	52	38	90	59	2	-100	-10	4
+415	7	-126	-109	21	104	0	4	-13	4
+416	19	-62	117	55	-118	0	16	-11	4
+417	9	64	-83	-19	-42	0	-64	-3	4
+418	19	123	-4	119	0	1	-40	-4	4
+419	13	4	-60	-56	69	1	20	-12	4
+420	9	-8	37	29	46	2	-24	-11	4
+421	11	109	54	-93	90	1	-76	-10	4
+422	11	98	61	-97	66	1	-120	-3	4
+423	9	-71	-88	97	-84	2	43	-8	4
+424	13	10	74	84	-49	1	50	-6	4
+425	7	54	-107	-53	-106	2	108	-11	4
+426	19	81	124	-51	-128	1	-120	-4	4
+427	17	73	-26	47	46	1	-1	-10	4
+428	9	74	44	118	81	1	-34	-4	4
+429	19	48	-3	45	6	1	-128	-3	4
+430	7	92	23	115	24	2	-72	-9	4
+431	7	125	-103	22	-103	2	-6	-7	4
+432	7	-100	30	-70	-29	1	56	-2	4
+433	5	-46	-122	88	-101	2	-46	-10	4
+434	15	-65	-44	-109	84	2	122	-12	4
+435	15	15	-35	-20	61	1	90	-3	4
+436	5	-120	-118	18	115	1	-120	-6	4
+437	11	7	-73	-66	87	1	28	-9	4
+438	11	-67	49	-18	49	2	-12	-15	4
+439	15	83	-42	41	42	1	-14	-10	4
+440	9	31	-93	-62	99	1	93	-13	4
+441	7	73	-97	-24	-25	1	-110	-1	4
+442	13	-26	68	42	69	2	126	-12	4
+443	19	-49	-9	-58	23	1	120	-9	4
+444	9	99	45	-112	81	1	41	-3	4
+445	19	46	126	-84	-97	1	112	-2	4
+446	13	30	-56	-26	73	2	-106	-8	4
+447	7	52	29	81	34	2	104	-3	4
+448	13	61	-61	0	71	2	49	-13	4
+449	9	-21	35	14	39	2	-63	-13	4
+450	13	-116	-51	89	50	1	-68	-3	4
+451	5	104	9	113	50	2	104	-7	4
+452	17	-77	101	24	-7	2	-27	-11	4
+453	17	30	-31	-1	34	1	-46	-15	4
+454	9	-36	-88	-124	-23	1	-108	-8	4
+455	9	-93	34	-59	38	2	-23	-14	4
+456	11	30	50	80	-13	1	120	-14	4
+457	9	74	43	117	80	1	-34	-5	4
+458	5	-36	-115	105	-110	2	-36	-3	4
+459	15	106	87	-63	124	2	124	-9	4
+460	7	-111	17	-94	21	1	34	-15	4
+461	11	-113	63	-50	-33	1	60	-1	4
+462	5	25	16	41	20	2	25	0	4
+463	17	-99	-26	-125	42	1	75	-10	4
+464	11	-121	-73	62	87	1	28	-9	4
+465	9	-127	46	-81	-42	0	-125	-2	4
+466	7	-63	29	-34	97	0	-126	-3	4
+467	11	-123	-79	54	81	1	20	-15	4
+468	13	-42	65	23	66	2	46	-15	4
+469	5	-32	9	-23	50	2	-32	-7	4
+470	19	21	115	-120	-73	1	-88	-13	4
+471	17	-16	104	88	125	2	-112	-8	4
+472	17	-122	106	-16	-101	1	-86	-6	4
+473	19	91	-14	77	54	1	-40	-14	4
+474	7	-46	-104	106	-19	1	-92	-8	4
+475	15	51	87	-118	-21	2	50	-9	4
+476	17	74	107	-75	-112	1	6	-5	4
+477	9	-35	-90	-125	-22	1	-105	-10	4
+478	9	-69	-85	102	-81	2	49	-5	4
+479	5	63	-124	-61	-124	2	63	-12	4
+480	11	109	50	-97	86	1	-76	-14	4
+481	11	71	63	-122	79	1	28	-1	4
+482	9	-67	35	-32	39	2	55	-13	4
+483	15	-46	96	50	-91	1	-20	0	4
+484	9	12	-94	-82	103	1	36	-14	4
+485	9	-90	-91	75	-90	2	-14	-11	4
+486	9	-74	-95	87	-94	2	34	-15	4
+487	19	66	-15	51	22	0	16	-15	4
+488	17	-62	-19	-81	18	0	78	-3	4
+489	9	23	-90	-67	102	1	69	-10	4
+490	7	102	-102	0	-85	2	-52	-6	4
+491	5	69	-114	-45	-14	1	69	-2	4
+492	11	-109	61	-48	-63	1	76	-3	4
+493	5	114	7	121	28	2	114	-9	4
+494	17	115	-25	90	-5	2	37	-9	4
+495	5	-69	-113	74	-109	2	-69	-1	4
+496	15	-106	-38	112	43	1	-124	-6	4
+497	11	-90	-77	89	84	1	-104	-13	4
+498	7	-74	30	-44	47	2	108	-2	4
+499	17	-92	-21	-113	28	1	124	-5	4
+500	15	-12	-39	-51	-18	2	-72	-7	4
+501	7	-23	29	6	33	2	-46	-3	4
+502	5	-42	-121	93	-104	2	-42	-9	4
+503	5	122	7	-127	12	2	122	-9	4
+504	9	68	-84	-16	-35	1	-52	-4	4
+505	13	-72	-51	-123	86	2	-104	-3	4
+506	15	-78	95	17	-28	2	44	-1	4
+507	5	67	-116	-49	-16	1	67	-4	4
+508	7	102	30	-124	47	2	-52	-2	4
+509	13	48	-50	-2	87	2	-16	-2	4
+510	13	-11	-53	-64	-33	2	-55	-5	4
+511	15	49	-37	12	99	2	38	-5	4
@@ -0,0 +1,204 @@
+// initial
+lane	a_1_1	b_1_1	c_1_1	d_1_1	e_1_1	f_1_1	n_1_1	STATE_0_0
+0	-128	-128	0	0	0	0	0	0
+1	-128	-1	0	0	0	0	0	0
+2	-128	0	0	0	0	0	0	0
+3	-128	1	0	0	0	0	0	0
+4	-128	7	0	0	0	0	0	0
+5	-128	127	0	0	0	0	0	0
+6	-1	-128	0	0	0	0	0	0
+7	-1	-1	0	0	0	0	0	0
+8	-1	0	0	0	0	0	0	0
+9	-1	1	0	0	0	0	0	0
+10	-1	7	0	0	0	0	0	0
+11	-1	127	0	0	0	0	0	0
+12	0	-128	0	0	0	0	0	0
+13	0	-1	0	0	0	0	0	0
+14	0	0	0	0	0	0	0	0
+15	0	1	0	0	0	0	0	0
+16	0	7	0	0	0	0	0	0
+17	0	127	0	0	0	0	0	0
+18	1	-128	0	0	0	0	0	0
+19	1	-1	0	0	0	0	0	0
+20	1	0	0	0	0	0	0	0
+21	1	1	0	0	0	0	0	0
+22	1	7	0	0	0	0	0	0
+23	1	127	0	0	0	0	0	0
+24	127	-128	0	0	0	0	0	0
+25	127	-1	0	0	0	0	0	0
+26	127	0	0	0	0	0	0	0
+27	127	1	0	0	0	0	0	0
+28	127	7	0	0	0	0	0	0
+29	127	127	0	0	0	0	0	0
+30	-128	-128	0	0	0	0	0	0
+31	-91	-37	0	0	0	0	0	0
+32	-54	54	0	0	0	0	0	0
+33	-17	-111	0	0	0	0	0	0
+34	20	-20	0	0	0	0	0	0
+35	57	71	0	0	0	0	0	0
+36	94	-94	0	0	0	0	0	0
+37	-125	-3	0	0	0	0	0	0
+38	-88	88	0	0	0	0	0	0
+39	-51	-77	0	0	0	0	0	0
+40	-14	14	0	0	0	0	0	0
+41	23	105	0	0	0	0	0	0
+42	60	-60	0	0	0	0	0	0
+43	97	31	0	0	0	0	0	0
+44	-122	122	0	0	0	0	0	0
+45	-85	-43	0	0	0	0	0	0
+46	-48	48	0	0	0	0	0	0
+47	-11	-117	0	0	0	0	0	0
+48	26	-26	0	0	0	0	0	0
+49	63	65	0	0	0	0	0	0
+50	100	-100	0	0	0	0	0	0
+51	-119	-9	0	0	0	0	0	0
+52	-82	82	0	0	0	0	0	0
+53	-45	-83	0	0	0	0	0	0
+54	-8	8	0	0	0	0	0	0
+55	29	99	0	0	0	0	0	0
+56	66	-66	0	0	0	0	0	0
+57	103	25	0	0	0	0	0	0
+58	-116	116	0	0	0	0	0	0
+59	-79	-49	0	0	0	0	0	0
+60	-42	42	0	0	0	0	0	0
+61	-5	-123	0	0	0	0	0	0
+62	32	-32	0	0	0	0	0	0
+63	69	59	0	0	0	0	0	0
+64	106	-106	0	0	0	0	0	0
+65	-113	-15	0	0	0	0	0	0
+66	-76	76	0	0	0	0	0	0
+67	-39	-89	0	0	0	0	0	0
+68	-2	2	0	0	0	0	0	0
+69	35	93	0	0	0	0	0	0
+70	72	-72	0	0	0	0	0	0
+71	109	19	0	0	0	0	0	0
+72	-110	110	0	0	0	0	0	0
+73	-73	-55	0	0	0	0	0	0
+74	-36	36	0	0	0	0	0	0
+75	1	127	0	0	0	0	0	0
+76	38	-38	0	0	0	0	0	0
+77	75	53	0	0	0	0	0	0
+78	112	-112	0	0	0	0	0	0
+79	-107	-21	0	0	0	0	0	0
+80	-70	70	0	0	0	0	0	0
+81	-33	-95	0	0	0	0	0	0
+82	4	-4	0	0	0	0	0	0
+83	41	87	0	0	0	0	0	0
+84	78	-78	0	0	0	0	0	0
+85	115	13	0	0	0	0	0	0
+86	-104	104	0	0	0	0	0	0
+87	-67	-61	0	0	0	0	0	0
+88	-30	30	0	0	0	0	0	0
+89	7	121	0	0	0	0	0	0
+90	44	-44	0	0	0	0	0	0
+91	81	47	0	0	0	0	0	0
+92	118	-118	0	0	0	0	0	0
+93	-101	-27	0	0	0	0	0	0
+94	-64	64	0	0	0	0	0	0
+95	-27	-101	0	0	0	0	0	0
+96	10	-10	0	0	0	0	0	0
+97	47	81	0	0	0	0	0	0
+98	84	-84	0	0	0	0	0	0
+99	121	7	0	0	0	0	0	0
+// final
+lane	cycles	a_1_1	b_1_1	c_1_1	d_1_1	e_1_1	f_1_1	n_1_1	STATE_0_0
+0	3	-128	-128	0	-123	1	0	0	4
+1	19	-128	-1	127	4	0	0	-1	4
+2	3	-128	0	-128	5	0	0	0	4
+3	5	-128	1	-127	-6	0	-128	-15	4
+4	5	-128	7	-121	-4	0	-128	-9	4
+5	19	-128	127	-1	-124	0	0	-1	4
+6	3	-1	-128	127	-128	2	0	0	4
+7	19	-1	-1	-2	-1	2	-8	-1	4
+8	3	-1	0	-1	0	2	0	0	4
+9	5	-1	1	0	1	2	-1	-15	4
+10	5	-1	7	6	7	2	-1	-9	4
+11	19	-1	127	126	127	1	-8	-1	4
+12	3	0	-128	-128	-123	0	0	0	4
+13	19	0	-1	-1	4	0	0	-1	4
+14	3	0	0	0	5	1	0	0	4
+15	5	0	1	1	-6	0	0	-15	4
+16	5	0	7	7	-4	0	0	-9	4
+17	19	0	127	127	-124	0	0	-1	4
+18	3	1	-128	-127	-124	1	0	0	4
+19	19	1	-1	0	7	0	8	-1	4
+20	3	1	0	1	4	1	0	0	4
+21	5	1	1	2	5	1	1	-15	4
+22	5	1	7	8	-1	0	1	-9	4
+23	19	1	127	-128	-121	0	8	-1	4
+24	3	127	-128	-1	-128	2	0	0	4
+25	19	127	-1	126	-1	1	-8	-1	4
+26	3	127	0	127	0	2	0	0	4
+27	5	127	1	-128	1	2	127	-15	4
+28	5	127	7	-122	7	2	127	-9	4
+29	19	127	127	-2	127	2	-8	-1	4
+30	3	-128	-128	0	-123	1	0	0	4
+31	15	-91	-37	-128	111	2	-34	-5	4
+32	11	-54	54	0	91	1	40	-10	4
+33	7	-17	-111	-128	-79	2	-34	-15	4
+34	17	20	-20	0	61	1	-116	-4	4
+35	13	57	71	-128	-49	2	29	-9	4
+36	9	94	-94	0	-29	1	26	-14	4
+37	19	-125	-3	-128	1	1	24	-3	4
+38	15	-88	88	0	-3	2	-16	-8	4
+39	11	-51	-77	-128	-41	1	52	-13	4
+40	5	-14	14	0	19	2	-14	-2	4
+41	17	23	105	-128	-71	1	-95	-7	4
+42	13	60	-60	0	69	2	44	-12	4
+43	7	97	31	-128	39	2	-62	-1	4
+44	19	-122	122	0	-117	1	48	-6	4
+45	15	-85	-43	-128	121	2	2	-11	4
+46	9	-48	48	0	117	1	112	0	4
+47	5	-11	-117	-128	-97	2	-11	-5	4
+48	17	26	-26	0	43	1	-74	-10	4
+49	13	63	65	-128	-63	2	59	-15	4
+50	7	100	-100	0	-83	2	-56	-4	4
+51	19	-119	-9	-128	31	1	72	-9	4
+52	15	-82	82	0	-13	2	20	-14	4
+53	9	-45	-83	-128	-15	1	121	-3	4
+54	5	-8	8	0	13	2	-8	-8	4
+55	17	29	99	-128	-89	1	-53	-13	4
+56	11	66	-66	0	-61	0	8	-2	4
+57	7	103	25	-128	41	2	-50	-7	4
+58	19	-116	116	0	-107	1	96	-12	4
+59	13	-79	-49	-128	87	2	117	-1	4
+60	9	-42	42	0	123	1	-126	-6	4
+61	5	-5	-123	-128	-119	2	-5	-11	4
+62	15	32	-32	0	101	1	-64	0	4
+63	11	69	59	-128	79	1	20	-5	4
+64	7	106	-106	0	-69	2	-44	-10	4
+65	19	-113	-15	-128	17	1	120	-15	4
+66	13	-76	76	0	-35	2	-124	-4	4
+67	9	-39	-89	-128	-17	1	-117	-9	4
+68	5	-2	2	0	3	2	-2	-14	4
+69	15	35	93	-128	-31	2	-46	-3	4
+70	11	72	-72	0	-35	1	32	-8	4
+71	7	109	19	-128	55	2	-38	-13	4
+72	17	-110	110	0	-77	1	-2	-2	4
+73	13	-73	-55	-128	89	2	-109	-7	4
+74	9	-36	36	0	101	1	-108	-12	4
+75	19	1	127	-128	-121	0	8	-1	4
+76	15	38	-38	0	107	2	-28	-6	4
+77	11	75	53	-128	89	1	44	-11	4
+78	5	112	-112	0	-107	2	112	0	4
+79	17	-107	-21	-128	63	1	19	-5	4
+80	13	-70	70	0	-53	2	-94	-10	4
+81	9	-33	-95	-128	-31	1	-99	-15	4
+82	19	4	-4	0	13	1	32	-4	4
+83	15	41	87	-128	-1	2	-10	-9	4
+84	11	78	-78	0	-45	1	56	-14	4
+85	5	115	13	-128	17	2	115	-3	4
+86	17	-104	104	0	-83	1	40	-8	4
+87	13	-67	-61	-128	71	2	-79	-13	4
+88	7	-30	30	0	35	2	-60	-2	4
+89	19	7	121	-128	-119	1	56	-7	4
+90	15	44	-44	0	117	2	8	-12	4
+91	9	81	47	-128	119	1	-13	-1	4
+92	5	118	-118	0	-101	2	118	-6	4
+93	17	-101	-27	-128	41	1	61	-11	4
+94	11	-64	64	0	69	0	0	0	4
+95	7	-27	-101	-128	-81	2	-54	-5	4
+96	19	10	-10	0	27	1	80	-10	4
+97	15	47	81	-128	-15	2	26	-15	4
+98	9	84	-84	0	-3	1	-4	-4	4
+99	5	121	7	-128	15	2	121	-9	4
@@ -0,0 +1,132 @@
+// initial
+lane	a_1_1	b_1_1	c_1_1	d_1_1	e_1_1	f_1_1	n_1_1	STATE_0_0
+0	0	0	0	0	0	0	0	0
+1	-58	-21	-28	76	89	51	-76	0
+2	95	-10	-74	-5	22	-55	-106	0
+3	-15	-13	-3	57	39	93	15	0
+4	46	-12	-53	-19	89	-75	109	0
+5	-65	-112	51	-5	-42	-100	-109	0
+6	-6	-112	-74	-94	31	-93	14	0
+7	-47	-77	-95	-125	86	62	11	0
+8	37	-98	-106	-22	-11	42	110	0
+9	112	-115	109	-122	-99	-83	93	0
+10	9	10	3	-91	-76	-13	8	0
+11	57	14	46	27	-11	111	91	0
+12	-32	88	-86	-122	-67	82	90	0
+13	-26	5	-45	-114	-12	38	4	0
+14	-1	-127	-107	-114	36	-110	58	0
+15	104	39	107	-28	-103	-10	79	0
+16	57	-72	-90	124	116	38	-4	0
+17	35	123	73	26	55	63	-31	0
+18	-102	-103	-118	109	-39	68	101	0
+19	106	-28	73	-25	-4	-40	121	0
+20	-91	-23	37	-73	-68	-33	-128	0
+21	-29	52	-83	111	-102	-62	-3	0
+22	-13	-49	-123	107	94	105	35	0
+23	-35	29	11	-34	-35	-101	-123	0
+24	21	82	23	31	50	-112	33	0
+25	-21	104	-92	0	114	49	-60	0
+26	108	-8	83	-59	-30	-43	-124	0
+27	-95	-42	125	125	-125	-78	-10	0
+28	-56	-19	99	-96	23	37	20	0
+29	28	-43	21	-39	115	-104	90	0
+30	100	-86	31	95	63	-53	-87	0
+31	84	-75	-24	39	44	-20	10	0
+32	6	-81	94	-108	-16	-74	50	0
+33	-95	46	58	93	-107	-112	108	0
+34	-23	13	122	112	-90	-62	78	0
+35	-85	-12	43	114	-95	31	95	0
+36	6	-74	103	84	-67	64	-93	0
+37	-109	-44	-89	-78	-33	-110	63	0
+38	112	-34	120	30	-125	-90	51	0
+39	55	119	94	14	-38	27	113	0
+40	-23	90	-84	7	-38	-90	-46	0
+41	23	1	50	116	-47	49	-10	0
+42	63	45	25	105	-100	-38	-31	0
+43	-90	83	63	113	-12	56	-87	0
+44	-79	-44	103	-108	-29	-26	-52	0
+45	-61	22	-115	-60	-95	-55	-108	0
+46	-57	-75	67	-39	-124	-87	-7	0
+47	70	106	35	55	-13	25	70	0
+48	29	104	56	82	-67	68	-45	0
+49	-35	-93	-2	37	-33	-30	61	0
+50	12	-66	-121	5	81	65	7	0
+51	-103	59	-5	-117	-90	-1	108	0
+52	107	-76	109	-31	42	-91	58	0
+53	-110	-35	-85	-64	110	46	-69	0
+54	90	-124	28	64	-104	16	11	0
+55	-46	31	-88	-76	-38	28	28	0
+56	-92	-45	67	42	-51	-53	23	0
+57	100	42	74	49	-75	-50	-65	0
+58	51	-69	117	-33	-83	-5	-84	0
+59	-43	111	100	-17	-15	113	104	0
+60	-19	81	61	52	-37	46	84	0
+61	30	72	39	88	-102	-27	115	0
+62	-121	-111	20	-20	84	-62	-97	0
+63	-31	-61	-82	-124	-89	-96	82	0
+// final
+lane	cycles	a_1_1	b_1_1	c_1_1	d_1_1	e_1_1	f_1_1	n_1_1	STATE_0_0
+0	3	0	0	0	5	1	0	0	4
+1	17	-58	-21	-79	28	1	106	-5	4
+2	19	95	-10	85	54	1	-8	-10	4
+3	19	-15	-13	-28	11	1	-120	-13	4
+4	19	46	-12	34	21	1	112	-12	4
+5	5	-65	-112	79	-112	2	-65	0	4
+6	5	-6	-112	-118	-107	2	-6	0	4
+7	11	-47	-77	-124	-53	1	68	-13	4
+8	7	37	-98	-61	-94	2	74	-2	4
+9	5	112	-115	-3	-106	2	112	-3	4
+10	5	9	10	19	-14	1	9	-6	4
+11	5	57	14	71	22	2	57	-2	4
+12	15	-32	88	56	109	2	64	-8	4
+13	5	-26	5	-21	6	2	-26	-11	4
+14	5	-1	-127	-128	-127	2	-1	-15	4
+15	9	104	39	-113	44	2	56	-9	4
+16	11	57	-72	-15	-68	2	-28	-8	4
+17	19	35	123	-98	-113	1	24	-5	4
+18	7	-102	-103	51	-98	2	52	-7	4
+19	17	106	-28	78	-23	2	-26	-12	4
+20	17	-91	-23	-114	25	1	-125	-7	4
+21	11	-29	52	23	72	1	-116	-12	4
+22	13	-13	-49	-62	-45	2	-65	-1	4
+23	7	-35	29	-6	29	1	-70	-3	4
+24	15	21	82	103	-42	2	126	-14	4
+25	17	-21	104	83	108	2	109	-8	4
+26	19	108	-8	100	25	1	96	-8	4
+27	15	-95	-42	119	110	2	-58	-10	4
+28	17	-56	-19	-75	22	1	120	-3	4
+29	15	28	-43	-15	90	2	-88	-11	4
+30	9	100	-86	14	-33	1	44	-6	4
+31	11	84	-75	9	-54	1	80	-11	4
+32	9	6	-81	-75	80	1	18	-1	4
+33	9	-95	46	-49	-42	1	-29	-2	4
+34	5	-23	13	-10	49	2	-23	-3	4
+35	19	-85	-12	-97	24	1	88	-12	4
+36	11	6	-74	-68	87	1	24	-10	4
+37	15	-109	-44	103	40	1	114	-12	4
+38	15	112	-34	78	-25	2	-96	-2	4
+39	19	55	119	-82	-9	1	-72	-9	4
+40	15	-23	90	67	98	2	118	-6	4
+41	5	23	1	24	1	2	23	-15	4
+42	9	63	45	108	45	2	-67	-3	4
+43	15	-90	83	-7	-12	2	-28	-13	4
+44	15	-79	-44	-123	104	2	38	-12	4
+45	7	-61	22	-39	106	1	-122	-10	4
+46	11	-57	-75	124	-43	1	28	-11	4
+47	17	70	106	-80	-101	1	-22	-6	4
+48	17	29	104	-123	-88	1	-53	-8	4
+49	9	-35	-93	-128	-25	1	-105	-13	4
+50	11	12	-66	-54	67	1	48	-2	4
+51	11	-103	59	-44	-61	1	100	-5	4
+52	11	107	-76	31	-40	1	-84	-12	4
+53	15	-110	-35	111	34	1	108	-3	4
+54	5	90	-124	-34	-119	2	90	-12	4
+55	7	-46	31	-15	100	1	-92	-1	4
+56	15	-92	-45	119	116	2	-40	-13	4
+57	9	100	42	-114	95	1	44	-6	4
+58	11	51	-69	-18	79	1	-52	-5	4
+59	17	-43	111	68	-77	1	-45	-1	4
+60	15	-19	81	62	113	2	-114	-15	4
+61	13	30	72	102	-55	2	-106	-8	4
+62	7	-121	-111	24	113	1	14	-15	4
+63	13	-31	-61	-92	-5	2	101	-13	4
@@ -0,0 +1,575 @@
+0	lab(0)
+1	const(0)
+2	const(-1)
+3	ld(a{1,1})
+4	ld(b{1,1})
+5	const(1)
+6	and(5, 4)
+7	sub(1, 6)
+8	and(7, 3)
+9	ssl(3, 5)
+10	ssr(4, 5)
+11	and(10, 5)
+12	sub(1, 11)
+13	and(12, 9)
+14	add(13, 8)
+15	ssl(9, 5)
+16	ssr(10, 5)
+17	and(16, 5)
+18	sub(1, 17)
+19	and(18, 15)
+20	add(19, 14)
+21	ssl(15, 5)
+22	ssr(16, 5)
+23	and(22, 5)
+24	sub(1, 23)
+25	and(24, 21)
+26	add(25, 20)
+27	ssl(21, 5)
+28	ssr(22, 5)
+29	and(28, 5)
+30	sub(1, 29)
+31	and(30, 27)
+32	add(31, 26)
+33	ssl(27, 5)
+34	ssr(28, 5)
+35	and(34, 5)
+36	sub(1, 35)
+37	and(36, 33)
+38	add(37, 32)
+39	ssl(33, 5)
+40	ssr(34, 5)
+41	and(40, 5)
+42	sub(1, 41)
+43	and(42, 39)
+44	add(43, 38)
+45	ssl(39, 5)
+46	ssr(40, 5)
+47	and(46, 5)
+48	sub(1, 47)
+49	and(48, 45)
+50	add(49, 44)
+51	ssl(45, 5)
+52	ssr(46, 5)
+53	and(52, 5)
+54	sub(1, 53)
+55	and(54, 51)
+56	add(55, 50)
+57	ssl(51, 5)
+58	ssr(52, 5)
+59	and(58, 5)
+60	sub(1, 59)
+61	and(60, 57)
+62	add(61, 56)
+63	ssl(57, 5)
+64	ssr(58, 5)
+65	and(64, 5)
+66	sub(1, 65)
+67	and(66, 63)
+68	add(67, 62)
+69	ssl(63, 5)
+70	ssr(64, 5)
+71	and(70, 5)
+72	sub(1, 71)
+73	and(72, 69)
+74	add(73, 68)
+75	ssl(69, 5)
+76	ssr(70, 5)
+77	and(76, 5)
+78	sub(1, 77)
+79	and(78, 75)
+80	add(79, 74)
+81	ssl(75, 5)
+82	ssr(76, 5)
+83	and(82, 5)
+84	sub(1, 83)
+85	and(84, 81)
+86	add(85, 80)
+87	ssl(81, 5)
+88	ssr(82, 5)
+89	and(88, 5)
+90	sub(1, 89)
+91	and(90, 87)
+92	add(91, 86)
+93	ssl(87, 5)
+94	ssr(88, 5)
+95	and(94, 5)
+96	sub(1, 95)
+97	and(96, 93)
+98	add(97, 92)
+99	ssl(93, 5)
+100	ssr(94, 5)
+101	and(100, 5)
+102	sub(1, 101)
+103	and(102, 99)
+104	add(103, 98)
+105	ssl(99, 5)
+106	ssr(100, 5)
+107	and(106, 5)
+108	sub(1, 107)
+109	and(108, 105)
+110	add(109, 104)
+111	ssl(105, 5)
+112	ssr(106, 5)
+113	and(112, 5)
+114	sub(1, 113)
+115	and(114, 111)
+116	add(115, 110)
+117	ssl(111, 5)
+118	ssr(112, 5)
+119	and(118, 5)
+120	sub(1, 119)
+121	and(120, 117)
+122	add(121, 116)
+123	ssl(117, 5)
+124	ssr(118, 5)
+125	and(124, 5)
+126	sub(1, 125)
+127	and(126, 123)
+128	add(127, 122)
+129	ssl(123, 5)
+130	ssr(124, 5)
+131	and(130, 5)
+132	sub(1, 131)
+133	and(132, 129)
+134	add(133, 128)
+135	ssl(129, 5)
+136	ssr(130, 5)
+137	and(136, 5)
+138	sub(1, 137)
+139	and(138, 135)
+140	add(139, 134)
+141	ssl(135, 5)
+142	ssr(136, 5)
+143	and(142, 5)
+144	sub(1, 143)
+145	and(144, 141)
+146	add(145, 140)
+147	ssl(141, 5)
+148	ssr(142, 5)
+149	and(148, 5)
+150	sub(1, 149)
+151	and(150, 147)
+152	add(151, 146)
+153	ssl(147, 5)
+154	ssr(148, 5)
+155	and(154, 5)
+156	sub(1, 155)
+157	and(156, 153)
+158	add(157, 152)
+159	ssl(153, 5)
+160	ssr(154, 5)
+161	and(160, 5)
+162	sub(1, 161)
+163	and(162, 159)
+164	add(163, 158)
+165	ssl(159, 5)
+166	ssr(160, 5)
+167	and(166, 5)
+168	sub(1, 167)
+169	and(168, 165)
+170	add(169, 164)
+171	ssl(165, 5)
+172	ssr(166, 5)
+173	and(172, 5)
+174	sub(1, 173)
+175	and(174, 171)
+176	add(175, 170)
+177	ssl(171, 5)
+178	ssr(172, 5)
+179	and(178, 5)
+180	sub(1, 179)
+181	and(180, 177)
+182	add(181, 176)
+183	ssl(177, 5)
+184	ssr(178, 5)
+185	and(184, 5)
+186	sub(1, 185)
+187	and(186, 183)
+188	add(187, 182)
+189	ssl(183, 5)
+190	ssr(184, 5)
+191	and(190, 5)
+192	sub(1, 191)
+193	and(192, 189)
+194	add(193, 188)
+195	st(c{1,1}, 194)
+196	const(7)
+197	and(196, 4)
+198	and(197, 5)
+199	sub(1, 198)
+200	and(199, 9)
+201	xor(199, 2)
+202	and(201, 3)
+203	or(202, 200)
+204	ssr(197, 5)
+205	and(204, 5)
+206	sub(1, 205)
+207	const(2)
+208	ssl(203, 207)
+209	and(208, 206)
+210	xor(206, 2)
+211	and(210, 203)
+212	or(211, 209)
+213	ssr(204, 5)
+214	and(213, 5)
+215	sub(1, 214)
+216	const(4)
+217	ssl(212, 216)
+218	and(217, 215)
+219	xor(215, 2)
+220	and(219, 212)
+221	or(220, 218)
+222	ssr(213, 5)
+223	and(222, 5)
+224	sub(1, 223)
+225	const(8)
+226	ssl(221, 225)
+227	and(226, 224)
+228	xor(224, 2)
+229	and(228, 221)
+230	or(229, 227)
+231	ssr(222, 5)
+232	and(231, 5)
+233	sub(1, 232)
+234	const(16)
+235	ssl(230, 234)
+236	and(235, 233)
+237	xor(233, 2)
+238	and(237, 230)
+239	or(238, 236)
+240	st(d{1,1}, 239)
+241	ssr(3, 5)
+242	and(241, 199)
+243	or(242, 202)
+244	ssr(243, 207)
+245	and(244, 206)
+246	and(243, 210)
+247	or(246, 245)
+248	ssr(247, 216)
+249	and(248, 215)
+250	and(247, 219)
+251	or(250, 249)
+252	ssr(251, 225)
+253	and(252, 224)
+254	and(251, 228)
+255	or(254, 253)
+256	ssr(255, 234)
+257	and(256, 233)
+258	and(255, 237)
+259	or(258, 257)
+260	st(e{1,1}, 259)
+261	const(3)
+262	add(261, 3)
+263	sub(4, 3)
+264	and(263, 5)
+265	sub(1, 264)
+266	and(265, 262)
+267	ssl(262, 5)
+268	ssr(263, 5)
+269	and(268, 5)
+270	sub(1, 269)
+271	and(270, 267)
+272	add(271, 266)
+273	ssl(267, 5)
+274	ssr(268, 5)
+275	and(274, 5)
+276	sub(1, 275)
+277	and(276, 273)
+278	add(277, 272)
+279	ssl(273, 5)
+280	ssr(274, 5)
+281	and(280, 5)
+282	sub(1, 281)
+283	and(282, 279)
+284	add(283, 278)
+285	ssl(279, 5)
+286	ssr(280, 5)
+287	and(286, 5)
+288	sub(1, 287)
+289	and(288, 285)
+290	add(289, 284)
+291	ssl(285, 5)
+292	ssr(286, 5)
+293	and(292, 5)
+294	sub(1, 293)
+295	and(294, 291)
+296	add(295, 290)
+297	ssl(291, 5)
+298	ssr(292, 5)
+299	and(298, 5)
+300	sub(1, 299)
+301	and(300, 297)
+302	add(301, 296)
+303	ssl(297, 5)
+304	ssr(298, 5)
+305	and(304, 5)
+306	sub(1, 305)
+307	and(306, 303)
+308	add(307, 302)
+309	ssl(303, 5)
+310	ssr(304, 5)
+311	and(310, 5)
+312	sub(1, 311)
+313	and(312, 309)
+314	add(313, 308)
+315	ssl(309, 5)
+316	ssr(310, 5)
+317	and(316, 5)
+318	sub(1, 317)
+319	and(318, 315)
+320	add(319, 314)
+321	ssl(315, 5)
+322	ssr(316, 5)
+323	and(322, 5)
+324	sub(1, 323)
+325	and(324, 321)
+326	add(325, 320)
+327	ssl(321, 5)
+328	ssr(322, 5)
+329	and(328, 5)
+330	sub(1, 329)
+331	and(330, 327)
+332	add(331, 326)
+333	ssl(327, 5)
+334	ssr(328, 5)
+335	and(334, 5)
+336	sub(1, 335)
+337	and(336, 333)
+338	add(337, 332)
+339	ssl(333, 5)
+340	ssr(334, 5)
+341	and(340, 5)
+342	sub(1, 341)
+343	and(342, 339)
+344	add(343, 338)
+345	ssl(339, 5)
+346	ssr(340, 5)
+347	and(346, 5)
+348	sub(1, 347)
+349	and(348, 345)
+350	add(349, 344)
+351	ssl(345, 5)
+352	ssr(346, 5)
+353	and(352, 5)
+354	sub(1, 353)
+355	and(354, 351)
+356	add(355, 350)
+357	ssl(351, 5)
+358	ssr(352, 5)
+359	and(358, 5)
+360	sub(1, 359)
+361	and(360, 357)
+362	add(361, 356)
+363	ssl(357, 5)
+364	ssr(358, 5)
+365	and(364, 5)
+366	sub(1, 365)
+367	and(366, 363)
+368	add(367, 362)
+369	ssl(363, 5)
+370	ssr(364, 5)
+371	and(370, 5)
+372	sub(1, 371)
+373	and(372, 369)
+374	add(373, 368)
+375	ssl(369, 5)
+376	ssr(370, 5)
+377	and(376, 5)
+378	sub(1, 377)
+379	and(378, 375)
+380	add(379, 374)
+381	ssl(375, 5)
+382	ssr(376, 5)
+383	and(382, 5)
+384	sub(1, 383)
+385	and(384, 381)
+386	add(385, 380)
+387	ssl(381, 5)
+388	ssr(382, 5)
+389	and(388, 5)
+390	sub(1, 389)
+391	and(390, 387)
+392	add(391, 386)
+393	ssl(387, 5)
+394	ssr(388, 5)
+395	and(394, 5)
+396	sub(1, 395)
+397	and(396, 393)
+398	add(397, 392)
+399	ssl(393, 5)
+400	ssr(394, 5)
+401	and(400, 5)
+402	sub(1, 401)
+403	and(402, 399)
+404	add(403, 398)
+405	ssl(399, 5)
+406	ssr(400, 5)
+407	and(406, 5)
+408	sub(1, 407)
+409	and(408, 405)
+410	add(409, 404)
+411	ssl(405, 5)
+412	ssr(406, 5)
+413	and(412, 5)
+414	sub(1, 413)
+415	and(414, 411)
+416	add(415, 410)
+417	ssl(411, 5)
+418	ssr(412, 5)
+419	and(418, 5)
+420	sub(1, 419)
+421	and(420, 417)
+422	add(421, 416)
+423	ssl(417, 5)
+424	ssr(418, 5)
+425	and(424, 5)
+426	sub(1, 425)
+427	and(426, 423)
+428	add(427, 422)
+429	ssl(423, 5)
+430	ssr(424, 5)
+431	and(430, 5)
+432	sub(1, 431)
+433	and(432, 429)
+434	add(433, 428)
+435	ssl(429, 5)
+436	ssr(430, 5)
+437	and(436, 5)
+438	sub(1, 437)
+439	and(438, 435)
+440	add(439, 434)
+441	ssl(435, 5)
+442	ssr(436, 5)
+443	and(442, 5)
+444	sub(1, 443)
+445	and(444, 441)
+446	add(445, 440)
+447	ssl(441, 5)
+448	ssr(442, 5)
+449	and(448, 5)
+450	sub(1, 449)
+451	and(450, 447)
+452	add(451, 446)
+453	st(f{1,1}, 452)
+454	lab(1)
+
+
+0	lab(0)
+0:	1	const(0)	2	const(-1)	5	const(1)	196	const(7)
+1:	3	ld(a{1,1})	4	ld(b{1,1})	207	const(2)	216	const(4)
+2:	6	and(5, 4)	9	ssl(3, 5)	10	ssr(4, 5)	197	and(196, 4)
+3:	7	sub(1, 6)	11	and(10, 5)	15	ssl(9, 5)	16	ssr(10, 5)
+4:	8	and(7, 3)	12	sub(1, 11)	17	and(16, 5)	21	ssl(15, 5)
+5:	13	and(12, 9)	18	sub(1, 17)	22	ssr(16, 5)	27	ssl(21, 5)
+6:	14	add(13, 8)	19	and(18, 15)	23	and(22, 5)	28	ssr(22, 5)
+7:	20	add(19, 14)	24	sub(1, 23)	29	and(28, 5)	33	ssl(27, 5)
+8:	25	and(24, 21)	30	sub(1, 29)	34	ssr(28, 5)	39	ssl(33, 5)
+9:	26	add(25, 20)	31	and(30, 27)	35	and(34, 5)	40	ssr(34, 5)
+10:	32	add(31, 26)	36	sub(1, 35)	41	and(40, 5)	45	ssl(39, 5)
+11:	37	and(36, 33)	42	sub(1, 41)	46	ssr(40, 5)	51	ssl(45, 5)
+12:	38	add(37, 32)	43	and(42, 39)	47	and(46, 5)	52	ssr(46, 5)
+13:	44	add(43, 38)	48	sub(1, 47)	53	and(52, 5)	57	ssl(51, 5)
+14:	49	and(48, 45)	54	sub(1, 53)	58	ssr(52, 5)	63	ssl(57, 5)
+15:	50	add(49, 44)	55	and(54, 51)	59	and(58, 5)	64	ssr(58, 5)
+16:	56	add(55, 50)	60	sub(1, 59)	65	and(64, 5)	69	ssl(63, 5)
+17:	61	and(60, 57)	66	sub(1, 65)	70	ssr(64, 5)	75	ssl(69, 5)
+18:	62	add(61, 56)	67	and(66, 63)	71	and(70, 5)	76	ssr(70, 5)
+19:	68	add(67, 62)	72	sub(1, 71)	77	and(76, 5)	81	ssl(75, 5)
+20:	73	and(72, 69)	78	sub(1, 77)	82	ssr(76, 5)	87	ssl(81, 5)
+21:	74	add(73, 68)	79	and(78, 75)	83	and(82, 5)	88	ssr(82, 5)
+22:	80	add(79, 74)	84	sub(1, 83)	89	and(88, 5)	93	ssl(87, 5)
+23:	85	and(84, 81)	90	sub(1, 89)	94	ssr(88, 5)	99	ssl(93, 5)
+24:	86	add(85, 80)	91	and(90, 87)	95	and(94, 5)	100	ssr(94, 5)
+25:	92	add(91, 86)	96	sub(1, 95)	101	and(100, 5)	105	ssl(99, 5)
+26:	97	and(96, 93)	102	sub(1, 101)	106	ssr(100, 5)	111	ssl(105, 5)
+27:	98	add(97, 92)	103	and(102, 99)	107	and(106, 5)	112	ssr(106, 5)
+28:	104	add(103, 98)	108	sub(1, 107)	113	and(112, 5)	117	ssl(111, 5)
+29:	109	and(108, 105)	114	sub(1, 113)	118	ssr(112, 5)	123	ssl(117, 5)
+30:	110	add(109, 104)	115	and(114, 111)	119	and(118, 5)	124	ssr(118, 5)
+31:	116	add(115, 110)	120	sub(1, 119)	125	and(124, 5)	129	ssl(123, 5)
+32:	121	and(120, 117)	126	sub(1, 125)	130	ssr(124, 5)	135	ssl(129, 5)
+33:	122	add(121, 116)	127	and(126, 123)	131	and(130, 5)	136	ssr(130, 5)
+34:	128	add(127, 122)	132	sub(1, 131)	137	and(136, 5)	141	ssl(135, 5)
+35:	133	and(132, 129)	138	sub(1, 137)	142	ssr(136, 5)	147	ssl(141, 5)
+36:	134	add(133, 128)	139	and(138, 135)	143	and(142, 5)	148	ssr(142, 5)
+37:	140	add(139, 134)	144	sub(1, 143)	149	and(148, 5)	153	ssl(147, 5)
+38:	145	and(144, 141)	150	sub(1, 149)	154	ssr(148, 5)	159	ssl(153, 5)
+39:	146	add(145, 140)	151	and(150, 147)	155	and(154, 5)	160	ssr(154, 5)
+40:	152	add(151, 146)	156	sub(1, 155)	161	and(160, 5)	165	ssl(159, 5)
+41:	157	and(156, 153)	162	sub(1, 161)	166	ssr(160, 5)	171	ssl(165, 5)
+42:	158	add(157, 152)	163	and(162, 159)	167	and(166, 5)	172	ssr(166, 5)
+43:	164	add(163, 158)	168	sub(1, 167)	173	and(172, 5)	177	ssl(171, 5)
+44:	169	and(168, 165)	174	sub(1, 173)	178	ssr(172, 5)	183	ssl(177, 5)
+45:	170	add(169, 164)	175	and(174, 171)	179	and(178, 5)	184	ssr(178, 5)
+46:	176	add(175, 170)	180	sub(1, 179)	185	and(184, 5)	189	ssl(183, 5)
+47:	181	and(180, 177)	186	sub(1, 185)	190	ssr(184, 5)	198	and(197, 5)
+48:	182	add(181, 176)	187	and(186, 183)	191	and(190, 5)	199	sub(1, 198)
+49:	188	add(187, 182)	192	sub(1, 191)	200	and(199, 9)	201	xor(199, 2)
+50:	193	and(192, 189)	202	and(201, 3)	204	ssr(197, 5)	225	const(8)
+51:	194	add(193, 188)	203	or(202, 200)	205	and(204, 5)	213	ssr(204, 5)
+52:	195	st(c{1,1}, 194)	206	sub(1, 205)	208	ssl(203, 207)	214	and(213, 5)
+53:	209	and(208, 206)	210	xor(206, 2)	215	sub(1, 214)	222	ssr(213, 5)
+54:	211	and(210, 203)	219	xor(215, 2)	223	and(222, 5)	231	ssr(222, 5)
+55:	212	or(211, 209)	224	sub(1, 223)	232	and(231, 5)	234	const(16)
+56:	217	ssl(212, 216)	220	and(219, 212)	228	xor(224, 2)	233	sub(1, 232)
+57:	218	and(217, 215)	237	xor(233, 2)	241	ssr(3, 5)	261	const(3)
+58:	221	or(220, 218)	242	and(241, 199)	262	add(261, 3)	263	sub(4, 3)
+59:	226	ssl(221, 225)	229	and(228, 221)	243	or(242, 202)	264	and(263, 5)
+60:	227	and(226, 224)	244	ssr(243, 207)	246	and(243, 210)	265	sub(1, 264)
+61:	230	or(229, 227)	245	and(244, 206)	266	and(265, 262)	267	ssl(262, 5)
+62:	235	ssl(230, 234)	238	and(237, 230)	247	or(246, 245)	268	ssr(263, 5)
+63:	236	and(235, 233)	248	ssr(247, 216)	250	and(247, 219)	269	and(268, 5)
+64:	239	or(238, 236)	249	and(248, 215)	270	sub(1, 269)	273	ssl(267, 5)
+65:	240	st(d{1,1}, 239)	251	or(250, 249)	271	and(270, 267)	274	ssr(268, 5)
+66:	252	ssr(251, 225)	254	and(251, 228)	272	add(271, 266)	275	and(274, 5)
+67:	253	and(252, 224)	276	sub(1, 275)	279	ssl(273, 5)	280	ssr(274, 5)
+68:	255	or(254, 253)	277	and(276, 273)	281	and(280, 5)	285	ssl(279, 5)
+69:	256	ssr(255, 234)	258	and(255, 237)	278	add(277, 272)	282	sub(1, 281)
+70:	257	and(256, 233)	283	and(282, 279)	286	ssr(280, 5)	291	ssl(285, 5)
+71:	259	or(258, 257)	284	add(283, 278)	287	and(286, 5)	292	ssr(286, 5)
+72:	260	st(e{1,1}, 259)	288	sub(1, 287)	293	and(292, 5)	297	ssl(291, 5)
+73:	289	and(288, 285)	294	sub(1, 293)	298	ssr(292, 5)	303	ssl(297, 5)
+74:	290	add(289, 284)	295	and(294, 291)	299	and(298, 5)	304	ssr(298, 5)
+75:	296	add(295, 290)	300	sub(1, 299)	305	and(304, 5)	309	ssl(303, 5)
+76:	301	and(300, 297)	306	sub(1, 305)	310	ssr(304, 5)	315	ssl(309, 5)
+77:	302	add(301, 296)	307	and(306, 303)	311	and(310, 5)	316	ssr(310, 5)
+78:	308	add(307, 302)	312	sub(1, 311)	317	and(316, 5)	321	ssl(315, 5)
+79:	313	and(312, 309)	318	sub(1, 317)	322	ssr(316, 5)	327	ssl(321, 5)
+80:	314	add(313, 308)	319	and(318, 315)	323	and(322, 5)	328	ssr(322, 5)
+81:	320	add(319, 314)	324	sub(1, 323)	329	and(328, 5)	333	ssl(327, 5)
+82:	325	and(324, 321)	330	sub(1, 329)	334	ssr(328, 5)	339	ssl(333, 5)
+83:	326	add(325, 320)	331	and(330, 327)	335	and(334, 5)	340	ssr(334, 5)
+84:	332	add(331, 326)	336	sub(1, 335)	341	and(340, 5)	345	ssl(339, 5)
+85:	337	and(336, 333)	342	sub(1, 341)	346	ssr(340, 5)	351	ssl(345, 5)
+86:	338	add(337, 332)	343	and(342, 339)	347	and(346, 5)	352	ssr(346, 5)
+87:	344	add(343, 338)	348	sub(1, 347)	353	and(352, 5)	357	ssl(351, 5)
+88:	349	and(348, 345)	354	sub(1, 353)	358	ssr(352, 5)	363	ssl(357, 5)
+89:	350	add(349, 344)	355	and(354, 351)	359	and(358, 5)	364	ssr(358, 5)
+90:	356	add(355, 350)	360	sub(1, 359)	365	and(364, 5)	369	ssl(363, 5)
+91:	361	and(360, 357)	366	sub(1, 365)	370	ssr(364, 5)	375	ssl(369, 5)
+92:	362	add(361, 356)	367	and(366, 363)	371	and(370, 5)	376	ssr(370, 5)
+93:	368	add(367, 362)	372	sub(1, 371)	377	and(376, 5)	381	ssl(375, 5)
+94:	373	and(372, 369)	378	sub(1, 377)	382	ssr(376, 5)	387	ssl(381, 5)
+95:	374	add(373, 368)	379	and(378, 375)	383	and(382, 5)	388	ssr(382, 5)
+96:	380	add(379, 374)	384	sub(1, 383)	389	and(388, 5)	393	ssl(387, 5)
+97:	385	and(384, 381)	390	sub(1, 389)	394	ssr(388, 5)	399	ssl(393, 5)
+98:	386	add(385, 380)	391	and(390, 387)	395	and(394, 5)	400	ssr(394, 5)
+99:	392	add(391, 386)	396	sub(1, 395)	401	and(400, 5)	405	ssl(399, 5)
+100:	397	and(396, 393)	402	sub(1, 401)	406	ssr(400, 5)	411	ssl(405, 5)
+101:	398	add(397, 392)	403	and(402, 399)	407	and(406, 5)	412	ssr(406, 5)
+102:	404	add(403, 398)	408	sub(1, 407)	413	and(412, 5)	417	ssl(411, 5)
+103:	409	and(408, 405)	414	sub(1, 413)	418	ssr(412, 5)	423	ssl(417, 5)
+104:	410	add(409, 404)	415	and(414, 411)	419	and(418, 5)	424	ssr(418, 5)
+105:	416	add(415, 410)	420	sub(1, 419)	425	and(424, 5)	429	ssl(423, 5)
+106:	421	and(420, 417)	426	sub(1, 425)	430	ssr(424, 5)	435	ssl(429, 5)
+107:	422	add(421, 416)	427	and(426, 423)	431	and(430, 5)	436	ssr(430, 5)
+108:	428	add(427, 422)	432	sub(1, 431)	437	and(436, 5)	441	ssl(435, 5)
+109:	433	and(432, 429)	438	sub(1, 437)	442	ssr(436, 5)	447	ssl(441, 5)
+110:	434	add(433, 428)	439	and(438, 435)	443	and(442, 5)	448	ssr(442, 5)
+111:	440	add(439, 434)	444	sub(1, 443)	449	and(448, 5)	
+112:	445	and(444, 441)	450	sub(1, 449)	
+113:	446	add(445, 440)	451	and(450, 447)	
+114:	452	add(451, 446)	
+115:	453	st(f{1,1}, 452)	
+454	lab(1)
@@ -0,0 +1,132 @@
+// initial
+lane	a_1_1	b_1_1	c_1_1	d_1_1	e_1_1	f_1_1	STATE_0_0
+0	0	0	0	0	0	0	0
+1	-5178	19684	13145	23988	22821	-18661	0
+2	-2465	-1098	-14058	-12906	29286	19434	0
+3	-3087	14845	23847	9743	29428	27155	0
+4	-3026	-4661	-19111	17005	-15547	-2192	0
+5	-28481	-1229	-25386	6035	-30313	-31873	0
+6	-28422	-23882	-23777	-17906	26723	181	0
+7	-19503	-31839	15958	15627	5302	-31915	0
+8	-25051	-5482	10997	-3218	-2633	27798	0
+9	-29328	-31123	-21091	-21667	19285	28191	0
+10	2569	-23293	-3148	13576	-13426	-8422	0
+11	3641	6958	28661	-7333	-23833	3272	0
+12	22752	-31062	21181	-25510	19804	17088	0
+13	1510	-28973	9972	-20220	-15223	649	0
+14	-32257	-29035	-28124	32314	-14392	30180	0
+15	10088	-7061	-2407	-14513	-758	4407	0
+16	-18375	31910	9844	22780	-25589	-19709	0
+17	31523	6729	16183	28129	27916	18407	0
+18	-26214	28042	17625	1381	31235	-30253	0
+19	-7062	-6327	-9988	26745	913	25365	0
+20	-5723	-18651	-8260	-32128	10912	766	0
+21	13539	28589	-15718	-4099	2238	5275	0
+22	-12301	27525	26974	-15837	15036	15449	0
+23	7645	-8693	-25635	-6267	-5260	24459	0
+24	21013	7959	-28622	4385	-18875	7839	0
+25	26859	164	12658	-23868	-20645	22280	0
+26	-1940	-15021	-10782	-20092	6016	30038	0
+27	-10591	32125	-19837	-27658	22004	16441	0
+28	-4664	-24477	9495	3348	-6658	-26417	0
+29	-10980	-9963	-26509	-9382	-19337	16086	0
+30	-21916	24351	-13505	4521	3197	-5911	0
+31	-19116	10216	-5076	24842	16344	21857	0
+32	-20730	-27554	-18704	32306	-13088	-5358	0
+33	11937	23866	-28523	3948	22467	-1915	0
+34	3561	28794	-15706	20814	21951	-4393	0
+35	-2901	29227	8097	-161	-32316	32674	0
+36	-18938	21607	16573	-14429	-16483	27733	0
+37	-11117	-19801	-27937	15679	-19634	17569	0
+38	-8592	7800	-22909	-14029	5768	-25608	0
+39	30519	3678	7130	-1167	16388	67	0
+40	23273	1964	-22822	13778	19827	-24703	0
+41	279	29746	12753	-14602	-22325	14120	0
+42	11583	26905	-9572	-18975	24190	-8808	0
+43	21414	28991	14580	169	16289	31074	0
+44	-11087	-27545	-6429	460	20318	6521	0
+45	5827	-15219	-13919	-22636	-25718	-25621	0
+46	-19001	-9917	-22140	-11527	-1584	-11742	0
+47	27206	14115	6643	-15546	-22006	-11984	0
+48	26653	21048	17597	16851	-13843	-31436	0
+49	-23587	9726	-7457	-9411	22493	-1000	0
+50	-16884	1415	16721	8455	12584	25663	0
+51	15257	-29701	-90	-1428	3740	-27443	0
+52	-19349	-7827	-23254	-31174	31015	30540	0
+53	-8814	-16213	11886	8891	-7395	25148	0
+54	-31654	16412	4248	25867	26113	-27289	0
+55	8146	-19288	7386	-23524	-29015	30166	0
+56	-11356	10819	-13363	-21225	25850	-5583	0
+57	10852	12618	-12619	9919	12360	-20933	0
+58	-17613	-8331	-1107	-25428	5348	-29933	0
+59	28629	-4252	29169	16232	-21231	15934	0
+60	20973	13373	11995	29780	4831	-16442	0
+61	18462	22567	-6758	7283	-15958	31726	0
+62	-28281	-5100	-15788	-21857	12007	21172	0
+63	-15391	-31570	-24409	19794	8601	-8762	0
+// final
+lane	cycles	a_1_1	b_1_1	c_1_1	d_1_1	e_1_1	f_1_1	STATE_0_0
+0	1	0	0	0	0	0	0	1
+1	1	-5178	19684	-15272	-17312	-324	-13682	1
+2	1	-2465	-1098	19594	-26688	-39	-23218	1
+3	1	-3087	14845	-16851	32288	-97	10096	1
+4	1	-3026	-4661	13946	-24208	-379	27405	1
+5	1	-28481	-1229	6925	-31240	-3561	-5144	1
+6	1	-28422	-23882	17852	16000	-445	18124	1
+7	1	-19503	-31839	2417	26530	-9752	-30656	1
+8	1	-25051	-5482	31662	-30400	-392	-20568	1
+9	1	-29328	-31123	-10064	-20992	-917	12967	1
+10	1	2569	-23293	-5349	20552	321	1976	1
+11	1	3641	6958	-28354	-29120	56	28524	1
+12	1	22752	-31062	17600	25472	5688	2590	1
+13	1	1510	-28973	28818	12080	188	16565	1
+14	1	-32257	-29035	7019	16352	-1009	17708	1
+15	1	10088	-7061	6264	15168	1261	30017	1
+16	1	-18375	31910	4342	3648	-288	24972	1
+17	1	31523	6729	-21765	-2490	15761	-7772	1
+18	1	-26214	28042	24324	26216	-6554	27184	1
+19	1	-7062	-6327	-14278	-14124	-3531	-11021	1
+20	1	-5723	-18651	-18471	13472	-179	23552	1
+21	1	13539	28589	10855	-25504	423	-9860	1
+22	1	-12301	27525	-26049	-416	-385	-29620	1
+23	1	7645	-8693	-4481	-4376	955	24128	1
+24	1	21013	7959	-5405	2688	164	-9168	1
+25	1	26859	164	13964	-29008	1678	13822	1
+26	1	-1940	-15021	-22780	-15520	-243	-24535	1
+27	1	-10591	32125	27037	-11232	-331	-13072	1
+28	1	-4664	-24477	-2984	28224	-583	8169	1
+29	1	-10980	-9963	14156	-23680	-344	-22489	1
+30	1	-21916	24351	-16868	12800	-172	-6851	1
+31	1	-19116	10216	8224	-19116	-19116	-27572	1
+32	1	-20730	-27554	-17356	-16000	-324	14360	1
+33	1	11937	23866	3450	-17788	2984	22532	1
+34	1	3561	28794	-28406	14244	890	15020	1
+35	1	-2901	29227	16057	-23208	-363	19712	1
+36	1	-18938	21607	13418	768	-148	-30871	1
+37	1	-11117	-19801	-7707	18816	-87	-20552	1
+38	1	-8592	7800	25728	-8592	-8592	-19560	1
+39	1	30519	3678	-14286	-12864	476	24534	1
+40	1	23273	1964	29580	-20848	1454	-11836	1
+41	1	279	29746	-23938	1116	69	-13378	1
+42	1	11583	26905	16935	23166	5791	-16332	1
+43	1	21414	28991	-9254	-11520	167	9473	1
+44	1	-11087	-27545	-6345	22656	-87	-31752	1
+45	1	5827	-15219	-10905	-10144	182	-14788	1
+46	1	-19001	-9917	16917	-20936	-2376	-21544	1
+47	1	27206	14115	-28270	21040	3400	-4859	1
+48	1	26653	21048	4184	26653	26653	15200	1
+49	1	-23587	9726	-31162	-2240	-369	-8224	1
+50	1	-16884	1415	29780	1536	-132	31285	1
+51	1	15257	-29701	-32253	-9016	1907	-28232	1
+52	1	-19349	-7827	-9073	-29344	-605	-16676	1
+53	1	-8814	-16213	-32634	-4976	-1102	-15731	1
+54	1	-31654	16412	-1576	17824	-1979	15738	1
+55	1	8146	-19288	-30256	8146	8146	-16370	1
+56	1	-11356	10819	19436	-25312	-1420	-28999	1
+57	1	10852	12618	25832	-22128	2713	-32118	1
+58	1	-17613	-8331	-1201	26208	-551	-9236	1
+59	1	28629	-4252	-30156	-688	1789	-24152	1
+60	1	20973	13373	-22151	15776	655	31488	1
+61	1	18462	22567	19602	3840	144	-26327	1
+62	1	-28281	-5100	-11636	6256	-1768	-21246	1
+63	1	-15391	-31570	9966	-1984	-241	-8812	1
@@ -0,0 +1,132 @@
+// initial
+lane	a_1_1	b_1_1	c_1_1	d_1_1	e_1_1	f_1_1	STATE_0_0
+0	0	0	0	0	0	0	0
+1	-58	-21	-28	76	89	51	0
+2	95	-10	-74	-5	22	-55	0
+3	-15	-13	-3	57	39	93	0
+4	46	-12	-53	-19	89	-75	0
+5	-65	-112	51	-5	-42	-100	0
+6	-6	-112	-74	-94	31	-93	0
+7	-47	-77	-95	-125	86	62	0
+8	37	-98	-106	-22	-11	42	0
+9	112	-115	109	-122	-99	-83	0
+10	9	10	3	-91	-76	-13	0
+11	57	14	46	27	-11	111	0
+12	-32	88	-86	-122	-67	82	0
+13	-26	5	-45	-114	-12	38	0
+14	-1	-127	-107	-114	36	-110	0
+15	104	39	107	-28	-103	-10	0
+16	57	-72	-90	124	116	38	0
+17	35	123	73	26	55	63	0
+18	-102	-103	-118	109	-39	68	0
+19	106	-28	73	-25	-4	-40	0
+20	-91	-23	37	-73	-68	-33	0
+21	-29	52	-83	111	-102	-62	0
+22	-13	-49	-123	107	94	105	0
+23	-35	29	11	-34	-35	-101	0
+24	21	82	23	31	50	-112	0
+25	-21	104	-92	0	114	49	0
+26	108	-8	83	-59	-30	-43	0
+27	-95	-42	125	125	-125	-78	0
+28	-56	-19	99	-96	23	37	0
+29	28	-43	21	-39	115	-104	0
+30	100	-86	31	95	63	-53	0
+31	84	-75	-24	39	44	-20	0
+32	6	-81	94	-108	-16	-74	0
+33	-95	46	58	93	-107	-112	0
+34	-23	13	122	112	-90	-62	0
+35	-85	-12	43	114	-95	31	0
+36	6	-74	103	84	-67	64	0
+37	-109	-44	-89	-78	-33	-110	0
+38	112	-34	120	30	-125	-90	0
+39	55	119	94	14	-38	27	0
+40	-23	90	-84	7	-38	-90	0
+41	23	1	50	116	-47	49	0
+42	63	45	25	105	-100	-38	0
+43	-90	83	63	113	-12	56	0
+44	-79	-44	103	-108	-29	-26	0
+45	-61	22	-115	-60	-95	-55	0
+46	-57	-75	67	-39	-124	-87	0
+47	70	106	35	55	-13	25	0
+48	29	104	56	82	-67	68	0
+49	-35	-93	-2	37	-33	-30	0
+50	12	-66	-121	5	81	65	0
+51	-103	59	-5	-117	-90	-1	0
+52	107	-76	109	-31	42	-91	0
+53	-110	-35	-85	-64	110	46	0
+54	90	-124	28	64	-104	16	0
+55	-46	31	-88	-76	-38	28	0
+56	-92	-45	67	42	-51	-53	0
+57	100	42	74	49	-75	-50	0
+58	51	-69	117	-33	-83	-5	0
+59	-43	111	100	-17	-15	113	0
+60	-19	81	61	52	-37	46	0
+61	30	72	39	88	-102	-27	0
+62	-121	-111	20	-20	84	-62	0
+63	-31	-61	-82	-124	-89	-96	0
+// final
+lane	cycles	a_1_1	b_1_1	c_1_1	d_1_1	e_1_1	f_1_1	STATE_0_0
+0	1	0	0	0	0	0	0	1
+1	1	-58	-21	-62	48	-8	13	1
+2	1	95	-10	74	-64	1	-50	1
+3	1	-15	-13	-61	-120	-2	-24	1
+4	1	46	-12	-40	-32	2	-26	1
+5	1	-65	-112	112	-65	-65	98	1
+6	1	-6	-112	-96	-6	-6	62	1
+7	1	-47	-77	35	-120	-6	40	1
+8	1	37	-98	-42	64	0	-24	1
+9	1	112	-115	-80	0	3	7	1
+10	1	9	10	90	36	2	12	1
+11	1	57	14	30	64	0	-20	1
+12	1	-32	88	0	-32	-32	104	1
+13	1	-26	5	126	-64	-1	55	1
+14	1	-1	-127	127	-2	-1	4	1
+15	1	104	39	-40	0	0	-43	1
+16	1	57	-72	-8	57	57	-60	1
+17	1	35	123	-47	24	4	16	1
+18	1	-102	-103	10	52	-51	99	1
+19	1	106	-28	104	-96	6	-14	1
+20	1	-91	-23	45	74	-46	-96	1
+21	1	-29	52	28	48	-2	-58	1
+22	1	-13	-49	125	-128	-1	104	1
+23	1	-35	29	9	-96	-2	0	1
+24	1	21	82	-70	84	5	-72	1
+25	1	-21	104	120	-21	-21	54	1
+26	1	108	-8	-96	108	108	-76	1
+27	1	-95	-42	-106	64	-2	-12	1
+28	1	-56	-19	40	0	-2	87	1
+29	1	28	-43	76	-128	0	103	1
+30	1	100	-86	104	-112	25	42	1
+31	1	84	-75	100	-128	2	-9	1
+32	1	6	-81	26	0	0	-15	1
+33	1	-95	46	-18	64	-2	84	1
+34	1	-23	13	-43	32	-1	48	1
+35	1	-85	-12	-4	-80	-6	-98	1
+36	1	6	-74	68	-128	0	48	1
+37	1	-109	-44	-68	48	-7	22	1
+38	1	112	-34	32	0	1	106	1
+39	1	55	119	-111	-128	0	-128	1
+40	1	-23	90	-22	-92	-6	44	1
+41	1	23	1	23	46	11	-60	1
+42	1	63	45	19	-32	1	92	1
+43	1	-90	83	-46	48	-12	53	1
+44	1	-79	-44	-108	16	-5	-100	1
+45	1	-61	22	-62	-64	-1	50	1
+46	1	-57	-75	-77	-32	-2	-52	1
+47	1	70	106	-4	24	17	68	1
+48	1	29	104	-56	29	29	96	1
+49	1	-35	-93	-73	-24	-5	64	1
+50	1	12	-66	-24	0	0	110	1
+51	1	-103	59	67	-56	-13	-72	1
+52	1	107	-76	60	-80	6	94	1
+53	1	-110	-35	10	64	-4	-89	1
+54	1	90	-124	104	-96	5	66	1
+55	1	-46	31	110	0	-1	17	1
+56	1	-92	-45	44	32	-12	-87	1
+57	1	100	42	104	-112	25	-86	1
+58	1	51	-69	65	-104	6	-80	1
+59	1	-43	111	91	-128	-1	-16	1
+60	1	-19	81	-3	-38	-10	-64	1
+61	1	30	72	112	30	30	106	1
+62	1	-121	-111	119	14	-61	100	1
+63	1	-31	-61	99	8	-4	72	1
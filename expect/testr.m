@@ -0,0 +1,63 @@
+0	lab(0)
+1	const(0)
+2	ld(a{1,1})
+3	ld(b{1,1})
+4	add(3, 2)
+5	st(e{1,1}, 4)
+6	sub(2, 3)
+7	st(f{1,1}, 6)
+8	and(3, 2)
+9	st(g{1,1}, 8)
+10	or(3, 2)
+11	st(h{1,1}, 10)
+12	const(1)
+13	add(12, 2)
+14	xor(13, 3)
+15	ld(c{1,1})
+16	add(15, 14)
+17	ld(d{1,1})
+18	and(17, 16)
+19	sub(18, 4)
+20	const(5)
+21	or(20, 19)
+22	xor(15, 2)
+23	const(7)
+24	add(23, 22)
+25	add(24, 21)
+26	st(x{1,1}, 25)
+27	add(17, 15)
+28	sub(15, 17)
+29	xor(28, 27)
+30	and(17, 15)
+31	xor(30, 29)
+32	st(y{1,1}, 31)
+33	lab(1)
+
+
+0	lab(0)
+0:	1	const(0)	12	const(1)
+1:	2	ld(a{1,1})	20	const(5)
+2:	23	const(7)	
+3:	3	ld(b{1,1})	
+4:	13	add(12, 2)	
+5:	15	ld(c{1,1})	
+6:	4	add(3, 2)	6	sub(2, 3)
+7:	5	st(e{1,1}, 4)	8	and(3, 2)
+8:	10	or(3, 2)	14	xor(13, 3)
+9:	7	st(f{1,1}, 6)	16	add(15, 14)
+10:	22	xor(15, 2)	
+11:	9	st(g{1,1}, 8)	24	add(23, 22)
+12:	
+13:	11	st(h{1,1}, 10)	
+14:	
+15:	17	ld(d{1,1})	
+16:	
+17:	
+18:	18	and(17, 16)	27	add(17, 15)
+19:	19	sub(18, 4)	28	sub(15, 17)
+20:	21	or(20, 19)	29	xor(28, 27)
+21:	25	add(24, 21)	30	and(17, 15)
+22:	26	st(x{1,1}, 25)	31	xor(30, 29)
+23:	
+24:	32	st(y{1,1}, 31)	
+33	lab(1)
@@ -0,0 +1,50 @@
+0	lab(0)
+1	const(0)
+2	ld(a{1,1})
+3	ld(b{1,1})
+4	add(3, 2)
+5	st(e{1,1}, 4)
+6	sub(2, 3)
+7	st(f{1,1}, 6)
+8	and(3, 2)
+9	st(g{1,1}, 8)
+10	or(3, 2)
+11	st(h{1,1}, 10)
+12	const(1)
+13	add(12, 2)
+14	xor(13, 3)
+15	ld(c{1,1})
+16	add(15, 14)
+17	ld(d{1,1})
+18	and(17, 16)
+19	sub(18, 4)
+20	const(5)
+21	or(20, 19)
+22	xor(15, 2)
+23	const(7)
+24	add(23, 22)
+25	add(24, 21)
+26	st(x{1,1}, 25)
+27	add(17, 15)
+28	sub(15, 17)
+29	xor(28, 27)
+30	and(17, 15)
+31	xor(30, 29)
+32	st(y{1,1}, 31)
+33	lab(1)
+
+
+0	lab(0)
+0:	1	const(0)	12	const(1)	20	const(5)	23	const(7)
+1:	2	ld(a{1,1})	3	ld(b{1,1})	15	ld(c{1,1})	17	ld(d{1,1})
+2:	4	add(3, 2)	6	sub(2, 3)	8	and(3, 2)	10	or(3, 2)
+3:	5	st(e{1,1}, 4)	7	st(f{1,1}, 6)	9	st(g{1,1}, 8)	11	st(h{1,1}, 10)
+4:	13	add(12, 2)	22	xor(15, 2)	27	add(17, 15)	28	sub(15, 17)
+5:	14	xor(13, 3)	24	add(23, 22)	29	xor(28, 27)	30	and(17, 15)
+6:	16	add(15, 14)	31	xor(30, 29)	
+7:	18	and(17, 16)	32	st(y{1,1}, 31)	
+8:	19	sub(18, 4)	
+9:	21	or(20, 19)	
+10:	25	add(24, 21)	
+11:	26	st(x{1,1}, 25)	
+33	lab(1)
@@ -0,0 +1,92 @@
+0	lab(0)
+1	const(0)
+2	st(i{1,1}, 1)
+3	ld(b{1,1})
+4	const(31)
+5	and(4, 3)
+6	st(n{1,1}, 5)
+7	st(s{1,1}, 1)
+8	lab(1)
+9	const(0)
+10	const(2)
+11	ld(i{1,1})
+12	add(11, 10)
+13	ld(n{1,1})
+14	gt(13, 12)
+15	sel(14, 3, 2)
+16	lab(3)
+17	const(0)
+18	ld(s{1,1})
+19	ld(a{1,1})
+20	add(19, 18)
+21	ld(i{1,1})
+22	xor(21, 19)
+23	const(1)
+24	add(23, 21)
+25	add(22, 20)
+26	xor(24, 22)
+27	add(24, 23)
+28	add(26, 25)
+29	st(s{1,1}, 28)
+30	xor(27, 26)
+31	st(a{1,1}, 30)
+32	add(27, 23)
+33	st(i{1,1}, 32)
+34	sel(-1, 1, 1)
+35	lab(2)
+36	lab(4)
+37	const(0)
+38	ld(i{1,1})
+39	ld(n{1,1})
+40	gt(39, 38)
+41	sel(40, 6, 5)
+42	lab(6)
+43	const(0)
+44	ld(s{1,1})
+45	ld(a{1,1})
+46	add(45, 44)
+47	st(s{1,1}, 46)
+48	ld(i{1,1})
+49	xor(48, 45)
+50	st(a{1,1}, 49)
+51	const(1)
+52	add(51, 48)
+53	st(i{1,1}, 52)
+54	sel(-1, 4, 4)
+55	lab(5)
+56	lab(7)
+
+
+0	lab(0)
+0:	1	const(0)	4	const(31)	
+1:	2	st(i{1,1}, 1)	3	ld(b{1,1})	7	st(s{1,1}, 1)	
+2:	5	and(4, 3)	
+3:	6	st(n{1,1}, 5)	
+8	lab(1)
+0:	9	const(0)	10	const(2)	
+1:	11	ld(i{1,1})	13	ld(n{1,1})	
+2:	12	add(11, 10)	
+3:	14	gt(13, 12)	
+15	sel(14, 3, 2)
+16	lab(3)
+0:	17	const(0)	23	const(1)	
+1:	18	ld(s{1,1})	19	ld(a{1,1})	21	ld(i{1,1})	
+2:	20	add(19, 18)	22	xor(21, 19)	24	add(23, 21)	
+3:	25	add(22, 20)	26	xor(24, 22)	27	add(24, 23)	
+4:	28	add(26, 25)	30	xor(27, 26)	32	add(27, 23)	
+5:	29	st(s{1,1}, 28)	31	st(a{1,1}, 30)	33	st(i{1,1}, 32)	
+34	sel(-1, 1, 1)
+35	lab(2)
+36	lab(4)
+0:	37	const(0)	
+1:	38	ld(i{1,1})	39	ld(n{1,1})	
+2:	40	gt(39, 38)	
+41	sel(40, 6, 5)
+42	lab(6)
+0:	43	const(0)	51	const(1)	
+1:	44	ld(s{1,1})	45	ld(a{1,1})	48	ld(i{1,1})	
+2:	46	add(45, 44)	49	xor(48, 45)	52	add(51, 48)	
+3:	47	st(s{1,1}, 46)	50	st(a{1,1}, 49)	53	st(i{1,1}, 52)	
+54	sel(-1, 4, 4)
+55	lab(5)
+56	lab(7)
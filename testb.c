@@ -0,0 +1,24 @@
+int n, w, x, y, z;
+
+t()
+{
+	x = 0;
+	y = 1;
+	n = n & 15;
+	while (n > 0) {
+		n = n - 1;
+		x = x + y;
+		if (x > 50) {
+			y = y ^ 5;
+			continue;
+		}
+		y = y + 1;
+		w = w ^ x;
+	}
+	if (z == 4) {
+		z = 5;
+	} else {
+		z = z + w;
+	}
+	if (0) x = 7;
+}
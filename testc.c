@@ -0,0 +1,16 @@
+int a, b, c, d, e, f, g;
+
+t()
+{
+	a = 4;
+	b = 6;
+	while (c > 0) {
+		c = c - a;
+		d = d + b;
+	}
+	if (d > b) d = a + b;
+	c = (a - b) & 15;
+	e = d;
+	if (e > b) f = e - a;
+	g = e + d;
+}
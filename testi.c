@@ -0,0 +1,14 @@
+int a, b, c, d, e, f, n;
+
+t()
+{
+	c = a + b;
+	d = (a - b) ^ (a | 5);
+	e = ((a & 63) > (b & 63)) + ((a & 63) >= 3) + (a == b);
+	f = 0;
+	n = b & 127;
+	while (n > 0) {
+		f = f + a;
+		n = n - 16;
+	}
+}
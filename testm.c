@@ -0,0 +1,9 @@
+int a, b, c, d, e, f;
+
+t()
+{
+	c = a * b;
+	d = a << (b & 7);
+	e = a >> (b & 7);
+	f = (a + 3) * (b - a);
+}
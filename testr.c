@@ -0,0 +1,11 @@
+int a, b, c, d, e, f, g, h, x, y;
+
+t()
+{
+	e = a + b;
+	f = a - b;
+	g = a & b;
+	h = a | b;
+	x = ((((((a + 1) ^ b) + c) & d) - e) | 5) + ((a ^ c) + 7);
+	y = (c + d) ^ (c - d) ^ (c & d);
+}
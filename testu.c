@@ -0,0 +1,13 @@
+int a, b, i, n, s;
+
+t()
+{
+	i = 0;
+	n = b & 31;
+	s = 0;
+	while (i < n) {
+		s = s + a;
+		a = a ^ i;
+		i = i + 1;
+	}
+}